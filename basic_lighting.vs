@@ -1,20 +1,57 @@
 #version 330 core
+// 定义 INSTANCED 时模型矩阵来自实例属性 (见 instanced_scene.h)，否则来自 uniform。
+// 定义 PRECOMPUTED_NORMAL_MATRIX 时法线矩阵由 CPU 预计算 (见 normal_matrix.h)，不再逐顶点求逆。
+// 定义 LOD_CROSSFADE 时 (只和 INSTANCED 一起使用) 每个实例另有一个 LOD 交叉淡化系数，交给 g_buffer.fs。
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec2 aTexCoords; // 接收纹理坐标属性
+#ifdef INSTANCED
+layout (location = 3) in mat4 aInstanceModel; // 每个实例的模型矩阵 (占用属性 3..6，divisor = 1)
+#ifdef PRECOMPUTED_NORMAL_MATRIX
+layout (location = 7) in mat3 aInstanceNormalMatrix; // 每个实例的法线矩阵 (占用属性 7..9，divisor = 1)
+#endif
+#ifdef LOD_CROSSFADE
+layout (location = 10) in float aInstanceFade; // 交叉淡化系数 (见 mesh_lod.h，divisor = 1)
+#endif
+#endif
+
+#ifndef VERTEX_POSITION
+#define VERTEX_POSITION(p) (p) // 位置未量化 (量化时由 vertex_format.h 生成的定义给出反量化)
+#endif
 
 out vec3 FragPos;
 out vec3 Normal;
 out vec2 TexCoords; // 将纹理坐标传递给片段着色器
+#ifdef LOD_CROSSFADE
+flat out float LodFade;
+#endif
 
+#ifndef INSTANCED
 uniform mat4 model;
+#ifdef PRECOMPUTED_NORMAL_MATRIX
+uniform mat3 normalMatrix;
+#endif
+#endif
 uniform mat4 view;
 uniform mat4 projection;
 
 void main()
 {
-    FragPos = vec3(model * vec4(aPos, 1.0));
+#ifdef INSTANCED
+    mat4 model = aInstanceModel;
+#ifdef PRECOMPUTED_NORMAL_MATRIX
+    mat3 normalMatrix = aInstanceNormalMatrix;
+#endif
+#endif
+    FragPos = vec3(model * vec4(VERTEX_POSITION(aPos), 1.0));
+#ifdef PRECOMPUTED_NORMAL_MATRIX
+    Normal = normalMatrix * aNormal;
+#else
     Normal = mat3(transpose(inverse(model))) * aNormal;
+#endif
     TexCoords = aTexCoords; // 传递纹理坐标
+#ifdef LOD_CROSSFADE
+    LodFade = aInstanceFade;
+#endif
     gl_Position = projection * view * vec4(FragPos, 1.0); //
-}
\ No newline at end of file
+}
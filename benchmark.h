@@ -0,0 +1,218 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "camera.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 离屏渲染目标：无窗口模式下替代默认帧缓冲 (FBO 0)
+struct OffscreenTarget
+{
+    unsigned int FBO = 0;
+    unsigned int ColorRBO = 0;
+    unsigned int DepthRBO = 0;
+
+    bool Create(unsigned int width, unsigned int height)
+    {
+        glGenFramebuffers(1, &FBO);
+        glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+        glGenRenderbuffers(1, &ColorRBO);
+        glBindRenderbuffer(GL_RENDERBUFFER, ColorRBO);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, ColorRBO);
+        // 与 G-buffer 的深度格式保持一致，glBlitFramebuffer 复制深度时要求格式匹配
+        glGenRenderbuffers(1, &DepthRBO);
+        glBindRenderbuffer(GL_RENDERBUFFER, DepthRBO);
+        // 与窗口默认帧缓冲一致的 D24S8 (从 G-buffer blit 深度要求格式相同，光源体积需要模板)
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, DepthRBO);
+        bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        if (!complete)
+            std::cout << "Offscreen framebuffer not complete!" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        return complete;
+    }
+
+    void Destroy()
+    {
+        glDeleteFramebuffers(1, &FBO);
+        glDeleteRenderbuffers(1, &ColorRBO);
+        glDeleteRenderbuffers(1, &DepthRBO);
+        FBO = ColorRBO = DepthRBO = 0;
+    }
+};
+
+// 脚本化摄像机路径：只依赖帧序号，不依赖真实时间，保证每次运行完全一致
+// 摄像机绕原点转一圈，高度做一次正弦起伏，始终看向原点
+inline void ApplyBenchmarkCameraPath(Camera& camera, int frame, int totalFrames)
+{
+    const float radius = 5.0f;
+    float t = totalFrames > 0 ? static_cast<float>(frame) / static_cast<float>(totalFrames) : 0.0f;
+    float angle = t * 360.0f;
+    float height = 1.5f * sin(glm::radians(angle * 2.0f));
+
+    glm::vec3 position;
+    position.x = radius * sin(glm::radians(angle));
+    position.y = height;
+    position.z = radius * cos(glm::radians(angle));
+
+    // 由指向原点的方向反推欧拉角
+    glm::vec3 dir = glm::normalize(-position);
+    float yaw = glm::degrees(atan2(dir.z, dir.x));
+    float pitch = glm::degrees(asin(dir.y));
+    camera.SetPose(position, yaw, pitch);
+}
+
+// 每帧的 CPU/GPU 耗时记录
+// GPU 耗时使用 GL_TIME_ELAPSED 查询，查询对象做成环形缓冲，
+// 延迟若干帧再读取结果，避免读取时阻塞管线。
+class FrameTimer
+{
+public:
+    struct FrameSample
+    {
+        int Frame;
+        double CpuMs;   // 从帧开始到提交完所有命令的 CPU 时间
+        double FrameMs; // 整帧墙钟时间 (包含等待 GPU 完成)
+        double GpuMs;   // GPU 执行本帧命令的时间，-1 表示没有拿到结果
+        int Objects;    // 本帧几何阶段绘制的物体数 (实例化压力测试中逐帧增长)
+        long long Triangles;  // 本帧几何阶段提交的三角形数
+        double ScreenError;   // LOD 的平均投影误差 (像素)，没有开启 LOD 时为 0
+    };
+
+    static const int QueryRingSize = 4;
+
+    FrameTimer()
+    {
+        glGenQueries(QueryRingSize, queries);
+        for (int i = 0; i < QueryRingSize; ++i)
+            pendingFrame[i] = -1;
+    }
+
+    // 需要在 OpenGL 上下文销毁前调用
+    void Destroy()
+    {
+        glDeleteQueries(QueryRingSize, queries);
+    }
+
+    void BeginFrame(int frame)
+    {
+        int slot = frame % QueryRingSize;
+        // 环形缓冲被占用时先把旧结果取回来 (此时它已经落后 QueryRingSize 帧，一般不会阻塞)
+        if (pendingFrame[slot] >= 0)
+            collect(slot, true);
+        currentFrame = frame;
+        glBeginQuery(GL_TIME_ELAPSED, queries[slot]);
+    }
+
+    void EndFrame(double cpuMs, double frameMs, int objects = 1, long long triangles = 0, double screenError = 0.0)
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        int slot = currentFrame % QueryRingSize;
+        pendingFrame[slot] = currentFrame;
+        samples.push_back({ currentFrame, cpuMs, frameMs, -1.0, objects, triangles, screenError });
+
+        // 顺便取回已经就绪的旧结果
+        for (int i = 0; i < QueryRingSize; ++i)
+            if (i != slot && pendingFrame[i] >= 0)
+                collect(i, false);
+    }
+
+    // 运行结束时取回所有还未读取的查询结果
+    void Finish()
+    {
+        for (int i = 0; i < QueryRingSize; ++i)
+            if (pendingFrame[i] >= 0)
+                collect(i, true);
+    }
+
+    bool WriteCsv(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file.is_open())
+        {
+            std::cout << "ERROR::BENCHMARK::CSV_OPEN_FAILED: " << path << std::endl;
+            return false;
+        }
+        file << "frame,cpu_ms,frame_ms,gpu_ms,objects,triangles,screen_error_px\n";
+        for (const FrameSample& s : samples)
+            file << s.Frame << "," << s.CpuMs << "," << s.FrameMs << "," << s.GpuMs << "," << s.Objects << ","
+                 << s.Triangles << "," << s.ScreenError << "\n";
+        std::cout << "Frame times written to " << path << std::endl;
+        return true;
+    }
+
+    void PrintSummary() const
+    {
+        std::vector<double> cpu, frame, gpu;
+        double triangles = 0.0, gpuTriangles = 0.0, gpuMs = 0.0;
+        for (const FrameSample& s : samples)
+        {
+            cpu.push_back(s.CpuMs);
+            frame.push_back(s.FrameMs);
+            triangles += static_cast<double>(s.Triangles);
+            if (s.GpuMs >= 0.0)
+            {
+                gpu.push_back(s.GpuMs);
+                gpuTriangles += static_cast<double>(s.Triangles);
+                gpuMs += s.GpuMs;
+            }
+        }
+        std::cout << "Benchmark: " << samples.size() << " frames" << std::endl;
+        printStat("cpu", cpu);
+        printStat("frame", frame);
+        printStat("gpu", gpu);
+        // 吞吐量按 GPU 时间计算 (只统计拿到 GPU 耗时的帧)
+        if (!samples.empty() && triangles > 0.0)
+            std::cout << "  triangles: avg " << static_cast<long long>(triangles / samples.size()) << "/frame, "
+                      << (gpuMs > 0.0 ? gpuTriangles / gpuMs / 1000.0 : 0.0) << " Mtri/s" << std::endl;
+    }
+
+private:
+    unsigned int queries[QueryRingSize];
+    int pendingFrame[QueryRingSize];
+    int currentFrame = 0;
+    std::vector<FrameSample> samples;
+
+    void collect(int slot, bool wait)
+    {
+        GLint available = 0;
+        if (!wait)
+        {
+            glGetQueryObjectiv(queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+                return;
+        }
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &elapsedNs);
+        // 帧序号从 0 开始连续递增，可以直接作为下标
+        samples[pendingFrame[slot]].GpuMs = static_cast<double>(elapsedNs) / 1.0e6;
+        pendingFrame[slot] = -1;
+    }
+
+    static void printStat(const char* name, std::vector<double> values)
+    {
+        if (values.empty())
+        {
+            std::cout << "  " << name << ": n/a" << std::endl;
+            return;
+        }
+        std::sort(values.begin(), values.end());
+        double sum = 0.0;
+        for (double v : values)
+            sum += v;
+        size_t p99 = std::min(values.size() - 1, static_cast<size_t>(values.size() * 0.99));
+        std::cout << "  " << name << ": avg " << sum / values.size()
+                  << " ms, p50 " << values[values.size() / 2]
+                  << " ms, p99 " << values[p99] << " ms" << std::endl;
+    }
+};
+
+#endif
@@ -75,6 +75,15 @@ public:
         return glm::lookAt(Position, Position + Front, Up);
     }
 
+    // 直接设置摄像机位置与朝向 (用于脚本化的基准测试路径)
+    void SetPose(glm::vec3 position, float yaw, float pitch)
+    {
+        Position = position;
+        Yaw = yaw;
+        Pitch = pitch;
+        updateCameraVectors();
+    }
+
     // 处理从任何类似键盘的输入系统接收到的输入。
     // 接受摄像机定义的ENUM形式的输入参数（以将其与窗口系统分离）
     void ProcessKeyboard(Camera_Movement direction, float deltaTime)
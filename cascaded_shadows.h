@@ -0,0 +1,315 @@
+#ifndef CASCADED_SHADOWS_H
+#define CASCADED_SHADOWS_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "cpu_profiler.h"
+#include "shader_m.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+
+// 方向光级联阴影 (CSM)
+// 摄像机视锥在 [near, ShadowDistance] 内按对数/线性混合的方式切成 CascadeCount 段，
+// 每段用包围球拟合一个正交投影，渲染到 2D 纹理数组的一层。包围球半径只取决于切分距离和视角，
+// 摄像机旋转时投影大小不变，再把投影中心对齐到 texel 网格，阴影边缘不会随摄像机移动闪烁。
+//
+// 缓存模式 (Cached = true) 下:
+//   - 级联的投影只在包围球中心漂移超过 RefitThreshold * 半径时重新拟合，拟合时半径额外放大
+//     同样的比例，保证两次拟合之间视锥切片始终被覆盖
+//   - 静态投射物只在重新拟合时画进 StaticCache 的对应层，之后每次更新只需把这一层复制过来，
+//     再叠加绘制动态投射物
+//   - 远处的级联每 UpdateIntervals[i] 帧才更新一次动态投射物 (重新拟合时总是立即更新)
+// 非缓存模式每帧重新拟合全部级联并绘制全部投射物，用于对比。
+class CascadedShadowMaps
+{
+public:
+    static const int CascadeCount = 4;     // 与 lighting_pass.fs 中的 CASCADE_COUNT 一致
+    static const int Resolution = 1024;    // 每层的边长 (texel)
+    static const unsigned int TextureUnit = 11; // 光照阶段使用的纹理单元 (G-buffer 占 0..3，分簇光照占 8..10)
+    constexpr static float ShadowDistance = 25.0f; // 阴影覆盖的最远视图深度
+    constexpr static float SplitLambda = 0.75f;    // 切分方案中对数分布的权重 (其余为均匀分布)
+    constexpr static float RefitThreshold = 0.1f;  // 缓存模式下重新拟合的漂移阈值 (相对半径)
+    constexpr static float CasterMargin = 20.0f;   // 投影沿光源方向向后延伸的距离，包含视锥外的投射物
+
+    // 各级联在缓存模式下更新动态投射物的间隔 (帧)
+    const int UpdateIntervals[CascadeCount] = { 1, 2, 4, 8 };
+
+    // 绘制投射物的回调: 调用方负责设置 model 并绘制，lightSpaceMatrix 已经设置好
+    typedef std::function<void(const Shader&)> DrawCasters;
+
+    bool Cached = true;
+    glm::vec3 SunDirection = glm::normalize(glm::vec3(-0.4f, -1.0f, -0.3f)); // 光线的传播方向
+    glm::vec3 SunColor = glm::vec3(0.6f);
+
+    Shader DepthShader;
+    unsigned int ShadowMap = 0;   // 光照阶段采样的深度纹理数组
+    unsigned int StaticCache = 0; // 只含静态投射物的深度纹理数组 (缓存模式)
+    unsigned int ShadowFBO = 0, StaticFBO = 0;
+
+    // 累计统计: 每个级联的重新拟合、静态层绘制和动态层更新次数
+    struct CascadeStats
+    {
+        int Refits = 0;
+        int StaticRenders = 0;
+        int Updates = 0;
+    };
+    CascadeStats Stats[CascadeCount];
+    int Frames = 0;
+
+    // vertexDefines: 网格顶点格式的着色器定义
+    // 在编译光照着色器之前调用，只有成功时光照着色器才以 CASCADED_SHADOWS 编译，再调用 BindLightingShader
+    bool Create(bool cached, const std::string& vertexDefines = "")
+    {
+        Cached = cached;
+        DepthShader = Shader("../shadow_depth.vs", "../shadow_depth.fs", vertexDefines);
+        if (DepthShader.ID == 0)
+            return false;
+        lightSpaceLocation = glGetUniformLocation(DepthShader.ID, "lightSpaceMatrix");
+
+        ShadowMap = createDepthArray(true);
+        ShadowFBO = createDepthOnlyFramebuffer();
+        if (Cached)
+        {
+            StaticCache = createDepthArray(false);
+            StaticFBO = createDepthOnlyFramebuffer();
+        }
+        return true;
+    }
+
+    // lightingShader: 以 CASCADED_SHADOWS 编译的光照着色器
+    void BindLightingShader(const Shader& lightingShader)
+    {
+        lightingShader.use();
+        lightingShader.setInt("cascadeShadowMap", TextureUnit);
+        matricesLocation = glGetUniformLocation(lightingShader.ID, "cascadeMatrices");
+        normalOffsetsLocation = glGetUniformLocation(lightingShader.ID, "cascadeNormalOffsets");
+        sunDirectionLocation = glGetUniformLocation(lightingShader.ID, "sunDirection");
+        sunColorLocation = glGetUniformLocation(lightingShader.ID, "sunColor");
+    }
+
+    void Destroy()
+    {
+        if (DepthShader.ID != 0)
+            glDeleteProgram(DepthShader.ID);
+        glDeleteTextures(1, &ShadowMap);
+        glDeleteTextures(1, &StaticCache);
+        glDeleteFramebuffers(1, &ShadowFBO);
+        glDeleteFramebuffers(1, &StaticFBO);
+        DepthShader.ID = 0;
+        ShadowMap = StaticCache = ShadowFBO = StaticFBO = 0;
+    }
+
+    // 每帧在光照阶段之前调用一次，按需更新各级联
+    // view/fovY/aspect/nearPlane 描述摄像机视锥
+    void Update(const glm::mat4& view, float fovY, float aspect, float nearPlane,
+                const DrawCasters& drawStatic, const DrawCasters& drawDynamic)
+    {
+        CPU_PROFILE_SCOPE("cascaded_shadows");
+        if (DepthShader.ID == 0)
+            return;
+        int frameIndex = Frames++; // 用于错开各级联的更新帧
+
+        GLint viewport[4];
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        glViewport(0, 0, Resolution, Resolution);
+        glEnable(GL_DEPTH_TEST);
+        glDepthMask(GL_TRUE);
+        // 深度偏移消除阴影痤疮，其余部分由着色器中的法线偏移处理
+        glEnable(GL_POLYGON_OFFSET_FILL);
+        glPolygonOffset(2.0f, 4.0f);
+        DepthShader.use();
+
+        glm::mat4 invView = glm::inverse(view);
+        float splitNear = nearPlane;
+        for (int i = 0; i < CascadeCount; ++i)
+        {
+            float splitFar = splitDistance(i + 1, nearPlane);
+            Cascade& cascade = cascades[i];
+
+            // 切片包围球: 中心在视线上，半径只取决于切分距离和视角
+            float tanY = std::tan(fovY * 0.5f);
+            float tanX = tanY * aspect;
+            float k = tanX * tanX + tanY * tanY;
+            // 使球心到近、远两个截面四角的距离相等，超出切片范围时钳制到远截面中心
+            float centerDepth = std::min(0.5f * (splitNear + splitFar) * (1.0f + k), splitFar);
+            float radius = std::max(glm::length(glm::vec3(tanX * splitFar, tanY * splitFar, splitFar - centerDepth)),
+                                    glm::length(glm::vec3(tanX * splitNear, tanY * splitNear, splitNear - centerDepth)));
+            glm::vec3 center = glm::vec3(invView * glm::vec4(0.0f, 0.0f, -centerDepth, 1.0f));
+
+            bool refit = !Cached || !cascade.Valid || SunDirection != cascade.Direction
+                || std::abs(radius - cascade.BaseRadius) > 1e-4f * radius
+                || glm::length(center - cascade.Center) > RefitThreshold * radius;
+            if (refit)
+            {
+                fit(cascade, center, radius);
+                ++Stats[i].Refits;
+            }
+
+            bool update = refit || !Cached || (frameIndex % UpdateIntervals[i]) == (i % UpdateIntervals[i]);
+            if (update)
+            {
+                glUniformMatrix4fv(lightSpaceLocation, 1, GL_FALSE, glm::value_ptr(cascade.LightSpace));
+                if (Cached)
+                {
+                    if (refit)
+                    {
+                        // 重新拟合后静态层失效，重画一次
+                        bindLayer(StaticFBO, StaticCache, i);
+                        glClear(GL_DEPTH_BUFFER_BIT);
+                        drawStatic(DepthShader);
+                        ++Stats[i].StaticRenders;
+                    }
+                    // 静态层复制到采样用的纹理，再叠加动态投射物
+                    bindLayer(StaticFBO, StaticCache, i, GL_READ_FRAMEBUFFER);
+                    bindLayer(ShadowFBO, ShadowMap, i, GL_DRAW_FRAMEBUFFER);
+                    glBlitFramebuffer(0, 0, Resolution, Resolution, 0, 0, Resolution, Resolution, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+                    bindLayer(ShadowFBO, ShadowMap, i);
+                }
+                else
+                {
+                    bindLayer(ShadowFBO, ShadowMap, i);
+                    glClear(GL_DEPTH_BUFFER_BIT);
+                    drawStatic(DepthShader);
+                }
+                drawDynamic(DepthShader);
+                ++Stats[i].Updates;
+            }
+            splitNear = splitFar;
+        }
+
+        glDisable(GL_POLYGON_OFFSET_FILL);
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    }
+
+    // 设置光照着色器的阴影 uniform 并绑定阴影贴图，在光照着色器 use() 之后调用
+    void Bind() const
+    {
+        glm::mat4 matrices[CascadeCount];
+        float normalOffsets[CascadeCount];
+        // [-1,1] -> [0,1]，着色器直接得到纹理坐标和比较深度
+        const glm::mat4 bias = glm::translate(glm::mat4(1.0f), glm::vec3(0.5f)) * glm::scale(glm::mat4(1.0f), glm::vec3(0.5f));
+        for (int i = 0; i < CascadeCount; ++i)
+        {
+            matrices[i] = bias * cascades[i].LightSpace;
+            // 沿法线偏移约 1.5 个 texel，消除大角度下的自阴影
+            normalOffsets[i] = 1.5f * 2.0f * cascades[i].Radius / Resolution;
+        }
+        glUniformMatrix4fv(matricesLocation, CascadeCount, GL_FALSE, glm::value_ptr(matrices[0]));
+        glUniform1fv(normalOffsetsLocation, CascadeCount, normalOffsets);
+        glUniform3fv(sunDirectionLocation, 1, glm::value_ptr(SunDirection));
+        glUniform3fv(sunColorLocation, 1, glm::value_ptr(SunColor));
+        glActiveTexture(GL_TEXTURE0 + TextureUnit);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, ShadowMap);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    void PrintSummary() const
+    {
+        if (DepthShader.ID == 0 || Frames == 0)
+            return;
+        std::cout << "Cascaded shadows (" << (Cached ? "cached" : "full") << ", " << Frames << " frames):" << std::endl;
+        for (int i = 0; i < CascadeCount; ++i)
+            std::cout << "  cascade " << i << ": radius " << cascades[i].Radius << ", " << Stats[i].Updates << " updates, "
+                      << Stats[i].Refits << " refits, " << Stats[i].StaticRenders << " static renders" << std::endl;
+    }
+
+private:
+    struct Cascade
+    {
+        bool Valid = false;
+        glm::vec3 Center = glm::vec3(0.0f); // 拟合时的 (未对齐) 包围球中心
+        glm::vec3 Direction = glm::vec3(0.0f);
+        float BaseRadius = 0.0f;            // 拟合时切片包围球的半径
+        float Radius = 0.0f;                // 实际投影的半宽 (缓存模式下包含漂移余量)
+        glm::mat4 LightSpace = glm::mat4(1.0f);
+    };
+    Cascade cascades[CascadeCount];
+
+    int lightSpaceLocation = -1;
+    int matricesLocation = -1;
+    int normalOffsetsLocation = -1;
+    int sunDirectionLocation = -1;
+    int sunColorLocation = -1;
+
+    // 第 index 个切分面的视图深度 (index = 0 为近平面，CascadeCount 为 ShadowDistance)
+    float splitDistance(int index, float nearPlane) const
+    {
+        float t = static_cast<float>(index) / CascadeCount;
+        float logSplit = nearPlane * std::pow(ShadowDistance / nearPlane, t);
+        float uniformSplit = nearPlane + (ShadowDistance - nearPlane) * t;
+        return SplitLambda * logSplit + (1.0f - SplitLambda) * uniformSplit;
+    }
+
+    void fit(Cascade& cascade, const glm::vec3& center, float radius)
+    {
+        cascade.Valid = true;
+        cascade.Center = center;
+        cascade.Direction = SunDirection;
+        cascade.BaseRadius = radius;
+        cascade.Radius = Cached ? radius * (1.0f + RefitThreshold) : radius;
+
+        glm::vec3 up = std::abs(SunDirection.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+        glm::mat4 lightView = glm::lookAt(glm::vec3(0.0f), SunDirection, up);
+        // 在光源空间把中心对齐到 texel 网格，投影只会整 texel 平移
+        glm::vec3 lightCenter = glm::vec3(lightView * glm::vec4(center, 1.0f));
+        float texel = 2.0f * cascade.Radius / Resolution;
+        lightCenter.x = std::floor(lightCenter.x / texel) * texel;
+        lightCenter.y = std::floor(lightCenter.y / texel) * texel;
+        float r = cascade.Radius;
+        // 光源视图沿 -z 看向 SunDirection，朝向光源的一侧 z 更大
+        glm::mat4 projection = glm::ortho(lightCenter.x - r, lightCenter.x + r, lightCenter.y - r, lightCenter.y + r,
+                                          -(lightCenter.z + r + CasterMargin), -(lightCenter.z - r));
+        cascade.LightSpace = projection * lightView;
+    }
+
+    void bindLayer(unsigned int fbo, unsigned int texture, int layer, GLenum target = GL_FRAMEBUFFER)
+    {
+        glBindFramebuffer(target, fbo);
+        glFramebufferTextureLayer(target, GL_DEPTH_ATTACHMENT, texture, 0, layer);
+    }
+
+    // 只有深度附件的帧缓冲，没有颜色缓冲可读写
+    unsigned int createDepthOnlyFramebuffer()
+    {
+        unsigned int fbo;
+        glGenFramebuffers(1, &fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        return fbo;
+    }
+
+    // 深度纹理数组，sampled 时开启硬件深度比较 (sampler2DArrayShadow)
+    unsigned int createDepthArray(bool sampled)
+    {
+        unsigned int texture;
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        if (GLAD_GL_VERSION_4_2)
+            glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_DEPTH_COMPONENT24, Resolution, Resolution, CascadeCount);
+        else
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_DEPTH_COMPONENT24, Resolution, Resolution, CascadeCount, 0,
+                         GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, nullptr);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, sampled ? GL_LINEAR : GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, sampled ? GL_LINEAR : GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        if (sampled)
+        {
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+            glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+        }
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        return texture;
+    }
+};
+
+#endif
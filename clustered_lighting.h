@@ -0,0 +1,316 @@
+#ifndef CLUSTERED_LIGHTING_H
+#define CLUSTERED_LIGHTING_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "cpu_profiler.h"
+#include "lights.h"
+#include "shader_m.h"
+#include "thread_pool.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+// CPU 分簇光源分配 (clustered shading)
+// 视锥体在屏幕上划分为 GridX x GridY 个块，深度方向按指数划分 GridZ 个切片，每个簇 (froxel) 是视图空间中的一个 AABB。
+// 每帧把光源变换到视图空间，按深度切片分给线程池，用 SIMD 一次测试多个簇的球体-AABB 相交，
+// 结果压缩成 (起点, 数量) 网格 + 光源索引列表，通过纹理缓冲 (TBO，GL 3.1 即可) 交给 lighting_pass.fs。
+// 片段着色器只遍历自己所在簇的光源，开销与场景中的光源总数无关。
+class ClusteredLighting
+{
+public:
+    static const int GridX = 16;
+    static const int GridY = 9;
+    static const int GridZ = 24;
+    static const int ClustersPerSlice = GridX * GridY;
+    static const int ClusterCount = ClustersPerSlice * GridZ;
+    // 光源数据/网格/索引三个纹理缓冲使用的纹理单元 (避开 G-buffer 使用的单元)
+    static const int FirstTextureUnit = 8;
+
+    unsigned int LightDataBuffer = 0, LightDataTexture = 0;
+    unsigned int GridBuffer = 0, GridTexture = 0;
+    unsigned int IndexBuffer = 0, IndexTexture = 0;
+
+    // 统计: 最近一帧的分配耗时和光源引用总数，以及累计值
+    double LastAssignMs = 0.0;
+    double TotalAssignMs = 0.0;
+    int AssignCount = 0;
+    size_t LastIndexCount = 0;
+
+    void Create(const Shader& shader, float nearPlane, float farPlane)
+    {
+        zNear = nearPlane;
+        zFar = farPlane;
+        createTextureBuffer(LightDataBuffer, LightDataTexture, GL_RGBA32F);
+        createTextureBuffer(GridBuffer, GridTexture, GL_RG32UI);
+        createTextureBuffer(IndexBuffer, IndexTexture, GL_R32UI);
+        clusterLights.resize(ClusterCount);
+
+        shader.use();
+        shader.setInt("lightData", FirstTextureUnit);
+        shader.setInt("lightGrid", FirstTextureUnit + 1);
+        shader.setInt("lightIndices", FirstTextureUnit + 2);
+    }
+
+    void Destroy()
+    {
+        glDeleteTextures(1, &LightDataTexture);
+        glDeleteTextures(1, &GridTexture);
+        glDeleteTextures(1, &IndexTexture);
+        glDeleteBuffers(1, &LightDataBuffer);
+        glDeleteBuffers(1, &GridBuffer);
+        glDeleteBuffers(1, &IndexBuffer);
+        LightDataTexture = GridTexture = IndexTexture = 0;
+        LightDataBuffer = GridBuffer = IndexBuffer = 0;
+    }
+
+    // 在 CPU 上把光源分配到簇中并上传结果
+    void Assign(const std::vector<PointLight>& lights, const glm::mat4& view, const glm::mat4& projection, ThreadPool& pool)
+    {
+        CPU_PROFILE_SCOPE("cluster_assign");
+        auto start = std::chrono::steady_clock::now();
+        updateClusterBounds(projection);
+        transformLights(lights, view);
+
+        // 每个深度切片是一个任务: 切片内的簇只由一个线程写入，不需要加锁
+        pool.ParallelFor(GridZ, [this](int slice) { assignSlice(slice); });
+
+        // 压缩为 (起点, 数量) 网格 + 连续的索引列表
+        grid.resize(ClusterCount * 2);
+        indices.clear();
+        for (int cluster = 0; cluster < ClusterCount; ++cluster)
+        {
+            grid[cluster * 2] = static_cast<uint32_t>(indices.size());
+            grid[cluster * 2 + 1] = static_cast<uint32_t>(clusterLights[cluster].size());
+            indices.insert(indices.end(), clusterLights[cluster].begin(), clusterLights[cluster].end());
+        }
+        LastIndexCount = indices.size();
+        LastAssignMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        TotalAssignMs += LastAssignMs;
+        ++AssignCount;
+
+        upload(LightDataBuffer, lights.data(), lights.size() * sizeof(PointLight));
+        upload(GridBuffer, grid.data(), grid.size() * sizeof(uint32_t));
+        upload(IndexBuffer, indices.data(), indices.size() * sizeof(uint32_t));
+    }
+
+    // 绑定纹理缓冲并设置着色器查找簇所需的 uniform
+    void Bind(const Shader& shader, const glm::mat4& view, glm::ivec2 screenSize) const
+    {
+        glActiveTexture(GL_TEXTURE0 + FirstTextureUnit);
+        glBindTexture(GL_TEXTURE_BUFFER, LightDataTexture);
+        glActiveTexture(GL_TEXTURE0 + FirstTextureUnit + 1);
+        glBindTexture(GL_TEXTURE_BUFFER, GridTexture);
+        glActiveTexture(GL_TEXTURE0 + FirstTextureUnit + 2);
+        glBindTexture(GL_TEXTURE_BUFFER, IndexTexture);
+        shader.setMat4("view", view);
+        shader.setVec2("screenSize", glm::vec2(screenSize));
+        glUniform3i(glGetUniformLocation(shader.ID, "clusterDims"), GridX, GridY, GridZ);
+        shader.setFloat("clusterNear", zNear);
+        shader.setFloat("clusterLogDepthRange", std::log(zFar / zNear));
+    }
+
+    void PrintSummary() const
+    {
+        if (AssignCount == 0)
+            return;
+        std::cout << "Cluster assignment (" << GridX << "x" << GridY << "x" << GridZ << "): avg "
+                  << TotalAssignMs / AssignCount << " ms, " << LastIndexCount << " light references" << std::endl;
+    }
+
+private:
+    // 一个深度切片内所有簇的 AABB (视图空间)，SoA 布局便于 SIMD 加载
+    struct SliceBounds
+    {
+        alignas(32) float MinX[ClustersPerSlice];
+        alignas(32) float MinY[ClustersPerSlice];
+        alignas(32) float MinZ[ClustersPerSlice];
+        alignas(32) float MaxX[ClustersPerSlice];
+        alignas(32) float MaxY[ClustersPerSlice];
+        alignas(32) float MaxZ[ClustersPerSlice];
+    };
+    static_assert(ClustersPerSlice % 8 == 0, "cluster rows must fill whole SIMD lanes");
+
+    // 视图空间中的光源 (SoA) 及其覆盖的深度切片范围
+    struct ViewLights
+    {
+        std::vector<float> X, Y, Z, RadiusSq;
+        std::vector<int> FirstSlice, LastSlice;
+    };
+
+    float zNear = 0.1f;
+    float zFar = 100.0f;
+    glm::vec2 projectionScale = glm::vec2(0.0f); // projection[0][0], projection[1][1]
+    std::vector<SliceBounds> slices = std::vector<SliceBounds>(GridZ);
+    ViewLights viewLights;
+    std::vector<std::vector<uint32_t>> clusterLights; // 每个簇的光源索引 (容量跨帧复用)
+    std::vector<uint32_t> grid;
+    std::vector<uint32_t> indices;
+
+    static void createTextureBuffer(unsigned int& buffer, unsigned int& texture, GLenum format)
+    {
+        glGenBuffers(1, &buffer);
+        glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+        glBufferData(GL_TEXTURE_BUFFER, 16, NULL, GL_DYNAMIC_DRAW);
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_BUFFER, texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, format, buffer);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    static void upload(unsigned int buffer, const void* data, size_t bytes)
+    {
+        glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+        // 空缓冲也保留一点存储，避免纹理缓冲绑定到大小为 0 的数据
+        glBufferData(GL_TEXTURE_BUFFER, bytes > 0 ? bytes : 16, bytes > 0 ? data : NULL, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    }
+
+    // 深度 d 所在的切片 (指数划分: 切片 k 覆盖 near * (far/near)^(k/GridZ) 到 near * (far/near)^((k+1)/GridZ))
+    int sliceOf(float depth) const
+    {
+        if (depth <= zNear)
+            return 0;
+        int slice = static_cast<int>(std::log(depth / zNear) / std::log(zFar / zNear) * GridZ);
+        return slice < GridZ ? slice : GridZ - 1;
+    }
+
+    float sliceDepth(int slice) const
+    {
+        return zNear * std::pow(zFar / zNear, static_cast<float>(slice) / GridZ);
+    }
+
+    // 簇的 AABB 只取决于投影矩阵 (视野和宽高比)，投影不变时沿用上一帧的结果
+    void updateClusterBounds(const glm::mat4& projection)
+    {
+        glm::vec2 scale(projection[0][0], projection[1][1]);
+        if (scale == projectionScale)
+            return;
+        projectionScale = scale;
+        for (int z = 0; z < GridZ; ++z)
+        {
+            float nearDepth = sliceDepth(z);
+            float farDepth = sliceDepth(z + 1);
+            SliceBounds& bounds = slices[z];
+            for (int y = 0; y < GridY; ++y)
+            {
+                // 块边界的 NDC 坐标换算成视图空间斜率 (x / -z)
+                float slopeY0 = (2.0f * y / GridY - 1.0f) / scale.y;
+                float slopeY1 = (2.0f * (y + 1) / GridY - 1.0f) / scale.y;
+                for (int x = 0; x < GridX; ++x)
+                {
+                    float slopeX0 = (2.0f * x / GridX - 1.0f) / scale.x;
+                    float slopeX1 = (2.0f * (x + 1) / GridX - 1.0f) / scale.x;
+                    int i = y * GridX + x;
+                    bounds.MinX[i] = std::min(slopeX0 * nearDepth, slopeX0 * farDepth);
+                    bounds.MaxX[i] = std::max(slopeX1 * nearDepth, slopeX1 * farDepth);
+                    bounds.MinY[i] = std::min(slopeY0 * nearDepth, slopeY0 * farDepth);
+                    bounds.MaxY[i] = std::max(slopeY1 * nearDepth, slopeY1 * farDepth);
+                    bounds.MinZ[i] = -farDepth;
+                    bounds.MaxZ[i] = -nearDepth;
+                }
+            }
+        }
+    }
+
+    void transformLights(const std::vector<PointLight>& lights, const glm::mat4& view)
+    {
+        size_t count = lights.size();
+        viewLights.X.resize(count);
+        viewLights.Y.resize(count);
+        viewLights.Z.resize(count);
+        viewLights.RadiusSq.resize(count);
+        viewLights.FirstSlice.resize(count);
+        viewLights.LastSlice.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            glm::vec3 center = glm::vec3(view * glm::vec4(glm::vec3(lights[i].PositionRadius), 1.0f));
+            float radius = lights[i].PositionRadius.w;
+            float depth = -center.z;
+            viewLights.X[i] = center.x;
+            viewLights.Y[i] = center.y;
+            viewLights.Z[i] = center.z;
+            viewLights.RadiusSq[i] = radius * radius;
+            if (depth + radius < zNear || depth - radius > zFar)
+            {
+                // 完全在近/远平面之外: 空范围
+                viewLights.FirstSlice[i] = 1;
+                viewLights.LastSlice[i] = 0;
+            }
+            else
+            {
+                viewLights.FirstSlice[i] = sliceOf(depth - radius);
+                viewLights.LastSlice[i] = sliceOf(depth + radius);
+            }
+        }
+    }
+
+    void assignSlice(int slice)
+    {
+        std::vector<uint32_t>* lists = &clusterLights[slice * ClustersPerSlice];
+        for (int i = 0; i < ClustersPerSlice; ++i)
+            lists[i].clear();
+        const SliceBounds& bounds = slices[slice];
+        size_t count = viewLights.X.size();
+        for (size_t light = 0; light < count; ++light)
+        {
+            if (slice < viewLights.FirstSlice[light] || slice > viewLights.LastSlice[light])
+                continue;
+            testSphere(bounds, viewLights.X[light], viewLights.Y[light], viewLights.Z[light], viewLights.RadiusSq[light],
+                       static_cast<uint32_t>(light), lists);
+        }
+    }
+
+    // 球体与切片内所有簇的 AABB 求交: 球心到 AABB 的最近距离平方 <= 半径平方
+    static void testSphere(const SliceBounds& b, float cx, float cy, float cz, float radiusSq, uint32_t light, std::vector<uint32_t>* lists)
+    {
+#if defined(__AVX__)
+        const __m256 x = _mm256_set1_ps(cx), y = _mm256_set1_ps(cy), z = _mm256_set1_ps(cz);
+        const __m256 r2 = _mm256_set1_ps(radiusSq), zero = _mm256_setzero_ps();
+        for (int i = 0; i < ClustersPerSlice; i += 8)
+        {
+            __m256 dx = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_load_ps(b.MinX + i), x), _mm256_sub_ps(x, _mm256_load_ps(b.MaxX + i))), zero);
+            __m256 dy = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_load_ps(b.MinY + i), y), _mm256_sub_ps(y, _mm256_load_ps(b.MaxY + i))), zero);
+            __m256 dz = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_load_ps(b.MinZ + i), z), _mm256_sub_ps(z, _mm256_load_ps(b.MaxZ + i))), zero);
+            __m256 d2 = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz));
+            int mask = _mm256_movemask_ps(_mm256_cmp_ps(d2, r2, _CMP_LE_OQ));
+            for (int lane = 0; mask != 0; ++lane, mask >>= 1)
+                if (mask & 1)
+                    lists[i + lane].push_back(light);
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        const __m128 x = _mm_set1_ps(cx), y = _mm_set1_ps(cy), z = _mm_set1_ps(cz);
+        const __m128 r2 = _mm_set1_ps(radiusSq), zero = _mm_setzero_ps();
+        for (int i = 0; i < ClustersPerSlice; i += 4)
+        {
+            __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_load_ps(b.MinX + i), x), _mm_sub_ps(x, _mm_load_ps(b.MaxX + i))), zero);
+            __m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_load_ps(b.MinY + i), y), _mm_sub_ps(y, _mm_load_ps(b.MaxY + i))), zero);
+            __m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_load_ps(b.MinZ + i), z), _mm_sub_ps(z, _mm_load_ps(b.MaxZ + i))), zero);
+            __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            int mask = _mm_movemask_ps(_mm_cmple_ps(d2, r2));
+            for (int lane = 0; mask != 0; ++lane, mask >>= 1)
+                if (mask & 1)
+                    lists[i + lane].push_back(light);
+        }
+#else
+        for (int i = 0; i < ClustersPerSlice; ++i)
+        {
+            float dx = std::max(std::max(b.MinX[i] - cx, cx - b.MaxX[i]), 0.0f);
+            float dy = std::max(std::max(b.MinY[i] - cy, cy - b.MaxY[i]), 0.0f);
+            float dz = std::max(std::max(b.MinZ[i] - cz, cz - b.MaxZ[i]), 0.0f);
+            if (dx * dx + dy * dy + dz * dz <= radiusSq)
+                lists[i].push_back(light);
+        }
+#endif
+    }
+};
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef CPU_PROFILER_H
+#define CPU_PROFILER_H
+
+// 作用域式 CPU 分析器
+// 用法: 在需要统计的代码块开头写 CPU_PROFILE_SCOPE("name");
+// 区段在作用域结束时记录到当前线程自己的环形缓冲中 (无锁，开销只有两次取时间)，
+// 调用 CPU_PROFILE_DUMP(path) 时把所有线程的记录导出为 chrome://tracing / Perfetto 可以打开的 JSON。
+//
+// 只有定义了 ENABLE_CPU_PROFILER (CMake 选项 ENABLE_CPU_PROFILER) 时才会编译进来，
+// 否则所有宏展开为空语句，不产生任何代码。
+
+#ifdef ENABLE_CPU_PROFILER
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class CpuProfiler
+{
+public:
+    // 每个线程环形缓冲可保存的区段数量，写满后覆盖最旧的记录
+    static const size_t RingCapacity = 1 << 16;
+
+    struct Zone
+    {
+        const char* Name; // 必须是静态生命周期的字符串 (通常是字面量)
+        uint64_t StartNs;
+        uint64_t DurationNs;
+    };
+
+    struct ThreadBuffer
+    {
+        uint32_t ThreadId;
+        std::vector<Zone> Zones;
+        std::atomic<uint64_t> Count{ 0 }; // 累计写入数量，取模得到写入位置
+    };
+
+    static CpuProfiler& Instance()
+    {
+        static CpuProfiler instance;
+        return instance;
+    }
+
+    // 当前线程的缓冲，第一次调用时创建并登记
+    ThreadBuffer& LocalBuffer()
+    {
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer)
+        {
+            std::unique_ptr<ThreadBuffer> created(new ThreadBuffer());
+            created->Zones.resize(RingCapacity);
+            std::lock_guard<std::mutex> lock(mutex);
+            created->ThreadId = static_cast<uint32_t>(buffers.size());
+            buffer = created.get();
+            buffers.push_back(std::move(created));
+        }
+        return *buffer;
+    }
+
+    uint64_t NowNs() const
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - epoch).count());
+    }
+
+    void Record(const char* name, uint64_t startNs, uint64_t endNs)
+    {
+        ThreadBuffer& buffer = LocalBuffer();
+        uint64_t index = buffer.Count.load(std::memory_order_relaxed);
+        buffer.Zones[index % RingCapacity] = { name, startNs, endNs - startNs };
+        buffer.Count.store(index + 1, std::memory_order_release);
+    }
+
+    // 导出 Chrome trace event 格式 ("ph":"X" 完整事件，时间单位微秒)
+    bool Dump(const std::string& path)
+    {
+        std::ofstream file(path);
+        if (!file.is_open())
+        {
+            std::cout << "ERROR::CPU_PROFILER::TRACE_OPEN_FAILED: " << path << std::endl;
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        // 微秒保留 3 位小数 (默认 6 位有效数字在运行 1 秒后就会退化成科学计数法)
+        file << std::fixed << std::setprecision(3);
+        file << "{\"traceEvents\":[\n";
+        bool first = true;
+        size_t total = 0;
+        for (const std::unique_ptr<ThreadBuffer>& buffer : buffers)
+        {
+            uint64_t count = buffer->Count.load(std::memory_order_acquire);
+            uint64_t begin = count > RingCapacity ? count - RingCapacity : 0;
+            for (uint64_t i = begin; i < count; ++i)
+            {
+                const Zone& zone = buffer->Zones[i % RingCapacity];
+                file << (first ? "" : ",\n")
+                     << "{\"name\":\"" << zone.Name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->ThreadId
+                     << ",\"ts\":" << zone.StartNs / 1000.0 << ",\"dur\":" << zone.DurationNs / 1000.0 << "}";
+                first = false;
+                ++total;
+            }
+        }
+        file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        std::cout << "CPU trace (" << total << " zones) written to " << path << std::endl;
+        return true;
+    }
+
+private:
+    std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+// RAII 区段: 构造时取开始时间，析构时记录
+class CpuProfileZone
+{
+public:
+    explicit CpuProfileZone(const char* name) : name(name), startNs(CpuProfiler::Instance().NowNs()) {}
+    ~CpuProfileZone()
+    {
+        CpuProfiler& profiler = CpuProfiler::Instance();
+        profiler.Record(name, startNs, profiler.NowNs());
+    }
+
+private:
+    const char* name;
+    uint64_t startNs;
+};
+
+#define CPU_PROFILE_CONCAT_INNER(a, b) a##b
+#define CPU_PROFILE_CONCAT(a, b) CPU_PROFILE_CONCAT_INNER(a, b)
+#define CPU_PROFILE_SCOPE(name) CpuProfileZone CPU_PROFILE_CONCAT(cpuProfileZone_, __LINE__)(name)
+#define CPU_PROFILE_DUMP(path) CpuProfiler::Instance().Dump(path)
+
+#else
+
+#define CPU_PROFILE_SCOPE(name) ((void)0)
+#define CPU_PROFILE_DUMP(path) ((void)0)
+
+#endif // ENABLE_CPU_PROFILER
+#endif
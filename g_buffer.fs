@@ -1,9 +1,21 @@
 #version 330 core
 // 定义 G-Buffer 的输出。每个 'out' 变量对应 FBO 的一个颜色附件。
 // layout (location = N) 指定了这个输出变量写入到 FBO 的第 N 个颜色附件。
+// 定义 GBUFFER_RECONSTRUCT_POSITION 时不输出位置 (光照阶段由深度重建)，其余附件依次前移。
+// 定义 GBUFFER_OCT_NORMALS 时法线以八面体编码写入两通道的 RG16 附件 (总是与 GBUFFER_RECONSTRUCT_POSITION 一起使用)。
+// 定义 LOD_CROSSFADE 时按实例的淡化系数做抖动丢弃，相邻两级 LOD 交叉淡化 (见 mesh_lod.h)。
+// 定义 SPECULAR_FROM_ALBEDO 时镜面强度取反照率的亮度 (多材质场景的第二种着色器变体，见 material_scene.h)。
+#if defined(GBUFFER_OCT_NORMALS)
+layout (location = 0) out vec2 gNormal;    // 输出附件0: 八面体编码的世界空间法线, [0,1]
+layout (location = 1) out vec4 gAlbedoSpec;// 输出附件1: 片段的反照率颜色(rgb)和镜面强度(a)
+#elif defined(GBUFFER_RECONSTRUCT_POSITION)
+layout (location = 0) out vec3 gNormal;    // 输出附件0: 片段的世界空间法线
+layout (location = 1) out vec4 gAlbedoSpec;// 输出附件1: 片段的反照率颜色(rgb)和镜面强度(a)
+#else
 layout (location = 0) out vec3 gPosition;  // 输出附件0: 片段的世界空间位置
 layout (location = 1) out vec3 gNormal;    // 输出附件1: 片段的世界空间法线
 layout (location = 2) out vec4 gAlbedoSpec;// 输出附件2: 片段的反照率颜色(rgb)和镜面强度(a)
+#endif
 
 // 从顶点着色器接收插值后的数据 (与 basic_lighting.vs 的输出一致)
 in vec3 FragPos;      // 接收顶点着色器传来的世界空间位置
@@ -13,14 +25,54 @@ in vec2 TexCoords;    // 接收顶点着色器传来的纹理坐标
 // 纹理采样器 (用于获取物体的反照率颜色)
 uniform sampler2D texture_diffuse1; // 对应之前 basic_lighting.fs 中的 texture1
 
+#ifdef LOD_CROSSFADE
+// 正值: 淡入的细一级，保留抖动阈值小于它的像素；负值: 淡出的粗一级，保留其余的像素。
+// 两级使用同一个屏幕空间 4x4 Bayer 阈值，合起来每个像素恰好由其中一级写入；完全显示时为 1
+flat in float LodFade;
+
+float ditherThreshold(ivec2 pixel)
+{
+    const int bayer[16] = int[16](0, 8, 2, 10, 12, 4, 14, 6, 3, 11, 1, 9, 15, 7, 13, 5);
+    return (float(bayer[(pixel.y & 3) * 4 + (pixel.x & 3)]) + 0.5) / 16.0;
+}
+#endif
+
+#ifdef GBUFFER_OCT_NORMALS
+// 八面体编码: 把单位球面投影到 |x|+|y|+|z|=1 的八面体上，下半球沿对角线翻折到正方形四角，
+// 两个分量即可表示任意方向，精度分布也比直接存 xy 均匀得多
+vec2 signNotZero(vec2 v)
+{
+    return vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+}
+
+vec2 encodeOctahedral(vec3 n)
+{
+    n /= (abs(n.x) + abs(n.y) + abs(n.z));
+    vec2 p = n.z >= 0.0 ? n.xy : (1.0 - abs(n.yx)) * signNotZero(n.xy);
+    return p * 0.5 + 0.5; // [-1,1] -> [0,1]，适配无符号归一化格式
+}
+#endif
+
 void main()
 {
+#ifdef LOD_CROSSFADE
+    float threshold = ditherThreshold(ivec2(gl_FragCoord.xy));
+    if (LodFade >= 0.0 ? threshold >= LodFade : threshold < -LodFade)
+        discard;
+#endif
+
+#ifndef GBUFFER_RECONSTRUCT_POSITION
     // 将插值后的世界空间位置直接写入 gPosition 附件
     gPosition = FragPos; //
+#endif
 
     // 将插值后的法线进行标准化 (确保长度为 1)，然后写入 gNormal 附件
     // 标准化对于后续在光照阶段进行正确的光照计算至关重要
+#ifdef GBUFFER_OCT_NORMALS
+    gNormal = encodeOctahedral(normalize(Normal));
+#else
     gNormal = normalize(Normal); //
+#endif
 
     // 从漫反射纹理中采样该片段的反照率颜色 (Albedo Color)
     // .rgb 表示我们只取纹理颜色值的 R, G, B 分量
@@ -28,5 +80,9 @@ void main()
 
     // 将镜面反射强度存储在 gAlbedoSpec 的 alpha 通道中
     // 这里我们暂时使用一个固定的值 0.5 作为示例
+#ifdef SPECULAR_FROM_ALBEDO
+    gAlbedoSpec.a = dot(gAlbedoSpec.rgb, vec3(0.299, 0.587, 0.114));
+#else
     gAlbedoSpec.a = 0.5f;
+#endif
 }
\ No newline at end of file
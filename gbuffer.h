@@ -0,0 +1,258 @@
+#ifndef GBUFFER_H
+#define GBUFFER_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "render_options.h"
+#include "shader_m.h"
+
+#include <iostream>
+#include <vector>
+
+// G-buffer 附件描述
+// 每种布局用一张描述表定义全部附件，创建、重建、绑定纹理和设置采样器都只读这张表，
+// 不再在 main() 和 framebuffer_size_callback 里各写一遍格式。
+struct GBufferAttachment
+{
+    const char* Name;      // 光照着色器中的采样器名 (同时用于调试输出)
+    GLenum InternalFormat; // 有尺寸的内部格式，供 glTexStorage2D 使用
+    GLenum Format;         // 以下两项仅在不支持 glTexStorage2D 时回退到 glTexImage2D 使用
+    GLenum Type;
+    bool Depth;            // 深度附件 (否则按表中顺序依次作为颜色附件)
+    bool Sampled;          // false 表示不需要采样，用 renderbuffer 即可
+};
+
+// 各布局的附件描述表 (颜色附件的顺序即 g_buffer.fs 中的输出 location)
+// 深度统一使用 D24S8: 与窗口默认帧缓冲格式相同，深度才能 blit 到输出帧缓冲
+inline std::vector<GBufferAttachment> GetGBufferAttachments(GBufferLayout layout)
+{
+    switch (layout)
+    {
+    case GBUFFER_DEPTH_RECONSTRUCT:
+        return {
+            { "gNormal",     GL_RGB16F,            GL_RGB,             GL_FLOAT,              false, true },
+            { "gAlbedoSpec", GL_RGBA8,             GL_RGBA,            GL_UNSIGNED_BYTE,      false, true },
+            { "gDepth",      GL_DEPTH24_STENCIL8,  GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8,  true,  true },
+        };
+    case GBUFFER_PACKED:
+        return {
+            { "gNormal",     GL_RG16,              GL_RG,              GL_UNSIGNED_SHORT,     false, true }, // 八面体编码
+            { "gAlbedoSpec", GL_RGBA8,             GL_RGBA,            GL_UNSIGNED_BYTE,      false, true },
+            { "gDepth",      GL_DEPTH24_STENCIL8,  GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8,  true,  true },
+        };
+    case GBUFFER_CLASSIC:
+    default:
+        return {
+            { "gPosition",   GL_RGB16F,            GL_RGB,             GL_FLOAT,              false, true },
+            { "gNormal",     GL_RGB16F,            GL_RGB,             GL_FLOAT,              false, true },
+            { "gAlbedoSpec", GL_RGBA8,             GL_RGBA,            GL_UNSIGNED_BYTE,      false, true },
+            { "rboDepth",    GL_DEPTH24_STENCIL8,  GL_DEPTH_STENCIL,   GL_UNSIGNED_INT_24_8,  true,  false },
+        };
+    }
+}
+
+// G-buffer 帧缓冲
+// 创建时按请求的尺寸精确分配 (离屏和固定分辨率的基准测试从不调整大小，不能为填充部分付带宽)。
+// 调整大小时不会每次都重新分配: 分配尺寸 (Capacity) 按 ResizeGranularity 向上取整，
+// 窗口变小或在容量内变大时只渲染到左下角的子矩形 (Size)，光照阶段用 UVScale 缩放纹理坐标。
+// 只有超出容量时才立即重建；明显变小 (面积不足一半) 并稳定 ShrinkDelay 秒后才缩小，
+// 拖动窗口边框时不会反复触发驱动的显存分配。
+class GBuffer
+{
+public:
+    // 分配尺寸的取整粒度 (像素)
+    static const int ResizeGranularity = 256;
+    // 缩小前需要保持稳定的时间 (秒)
+    constexpr static double ShrinkDelay = 0.5;
+
+    unsigned int FBO = 0;
+    GBufferLayout Layout = GBUFFER_CLASSIC;
+    // 当前渲染使用的尺寸与实际分配的尺寸
+    glm::ivec2 Size = glm::ivec2(0);
+    glm::ivec2 Capacity = glm::ivec2(0);
+    // 重新分配的次数 (用于观察调整窗口大小时的开销)
+    int Reallocations = 0;
+
+    bool Create(GBufferLayout layout, int width, int height)
+    {
+        Layout = layout;
+        attachments = GetGBufferAttachments(layout);
+        handles.assign(attachments.size(), 0);
+        Size = glm::ivec2(width, height);
+        glGenFramebuffers(1, &FBO);
+        return allocate(Size);
+    }
+
+    void Destroy()
+    {
+        release();
+        glDeleteFramebuffers(1, &FBO);
+        FBO = 0;
+    }
+
+    // 窗口大小变化时调用
+    void Resize(int width, int height, double now)
+    {
+        if (width <= 0 || height <= 0) // 最小化
+            return;
+        Size = glm::ivec2(width, height);
+        if (Size.x > Capacity.x || Size.y > Capacity.y)
+        {
+            // 放不下: 立即按取整后的尺寸重建
+            allocate(glm::max(roundUp(Size), Capacity));
+            shrinkPending = false;
+        }
+        else if (Size.x * 2 < Capacity.x || Size.y * 2 < Capacity.y)
+        {
+            // 明显变小: 记下时间，等尺寸稳定后再缩小
+            shrinkPending = true;
+            lastResizeTime = now;
+        }
+        else
+        {
+            shrinkPending = false;
+        }
+    }
+
+    // 每帧调用，处理延迟的缩小
+    void Update(double now)
+    {
+        if (shrinkPending && now - lastResizeTime >= ShrinkDelay)
+        {
+            shrinkPending = false;
+            allocate(roundUp(Size));
+        }
+    }
+
+    // 纹理坐标缩放: 只采样实际渲染的子矩形
+    glm::vec2 UVScale() const
+    {
+        return glm::vec2(Size) / glm::vec2(Capacity);
+    }
+
+    // 把每个可采样附件的采样器 uniform 指向固定的纹理单元 (初始化时调用一次)
+    void SetSamplerUniforms(const Shader& shader) const
+    {
+        shader.use();
+        int unit = 0;
+        for (const GBufferAttachment& attachment : attachments)
+            if (attachment.Sampled)
+                shader.setInt(attachment.Name, unit++);
+    }
+
+    // 把可采样附件绑定到 SetSamplerUniforms 设置的纹理单元上
+    void BindTextures() const
+    {
+        int unit = 0;
+        for (size_t i = 0; i < attachments.size(); ++i)
+        {
+            if (!attachments[i].Sampled)
+                continue;
+            glActiveTexture(GL_TEXTURE0 + unit++);
+            glBindTexture(GL_TEXTURE_2D, handles[i]);
+        }
+    }
+
+    // 按名字取附件的纹理/renderbuffer 句柄，不存在时返回 0
+    unsigned int Texture(const char* name) const
+    {
+        for (size_t i = 0; i < attachments.size(); ++i)
+            if (std::string(attachments[i].Name) == name)
+                return handles[i];
+        return 0;
+    }
+
+    // 每像素字节数 (用于输出带宽估算)
+    int BytesPerPixel() const
+    {
+        int bytes = 0;
+        for (const GBufferAttachment& attachment : attachments)
+        {
+            switch (attachment.InternalFormat)
+            {
+            case GL_RGB16F: bytes += 6; break;
+            case GL_RGBA16F: bytes += 8; break;
+            case GL_RG16: case GL_RGBA8: case GL_DEPTH_COMPONENT24: case GL_DEPTH24_STENCIL8: bytes += 4; break;
+            default: bytes += 4; break;
+            }
+        }
+        return bytes;
+    }
+
+private:
+    std::vector<GBufferAttachment> attachments;
+    std::vector<unsigned int> handles;
+    bool shrinkPending = false;
+    double lastResizeTime = 0.0;
+
+    static glm::ivec2 roundUp(glm::ivec2 size)
+    {
+        return (size + (ResizeGranularity - 1)) / ResizeGranularity * ResizeGranularity;
+    }
+
+    void release()
+    {
+        for (size_t i = 0; i < attachments.size(); ++i)
+        {
+            if (attachments[i].Sampled)
+                glDeleteTextures(1, &handles[i]);
+            else
+                glDeleteRenderbuffers(1, &handles[i]);
+            handles[i] = 0;
+        }
+    }
+
+    // 按描述表 (重新) 创建全部附件。
+    // glTexStorage2D 分配的是不可变存储，尺寸变化时只能删掉重建，这正是上面要尽量减少重建次数的原因。
+    bool allocate(glm::ivec2 capacity)
+    {
+        release();
+        Capacity = capacity;
+        ++Reallocations;
+
+        glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+        std::vector<unsigned int> drawBuffers;
+        for (size_t i = 0; i < attachments.size(); ++i)
+        {
+            const GBufferAttachment& attachment = attachments[i];
+            GLenum attachPoint = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(drawBuffers.size());
+            if (attachment.Depth)
+                attachPoint = attachment.InternalFormat == GL_DEPTH24_STENCIL8 ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+            if (attachment.Sampled)
+            {
+                glGenTextures(1, &handles[i]);
+                glBindTexture(GL_TEXTURE_2D, handles[i]);
+                if (GLAD_GL_VERSION_4_2)
+                    glTexStorage2D(GL_TEXTURE_2D, 1, attachment.InternalFormat, Capacity.x, Capacity.y);
+                else
+                    glTexImage2D(GL_TEXTURE_2D, 0, attachment.InternalFormat, Capacity.x, Capacity.y, 0, attachment.Format, attachment.Type, NULL);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                glFramebufferTexture2D(GL_FRAMEBUFFER, attachPoint, GL_TEXTURE_2D, handles[i], 0);
+            }
+            else
+            {
+                glGenRenderbuffers(1, &handles[i]);
+                glBindRenderbuffer(GL_RENDERBUFFER, handles[i]);
+                glRenderbufferStorage(GL_RENDERBUFFER, attachment.InternalFormat, Capacity.x, Capacity.y);
+                glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachPoint, GL_RENDERBUFFER, handles[i]);
+            }
+            if (!attachment.Depth)
+                drawBuffers.push_back(attachPoint);
+        }
+        // 告诉 OpenGL 我们要绘制到哪些颜色附件
+        glDrawBuffers(static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+
+        // 检查帧缓冲是否完整
+        bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        if (!complete)
+            std::cout << "Framebuffer not complete!" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        return complete;
+    }
+};
+
+#endif
@@ -0,0 +1,190 @@
+// 文件名: gpu_culling.cs
+#version 430 core
+// GPU 驱动的视锥体/遮挡剔除
+// 每个线程测试一个物体: 网格局部包围盒经模型矩阵变换成世界空间 AABB，与 6 个视锥体平面比较。
+// 可见物体的模型矩阵 (和法线矩阵) 紧凑地写入可见实例缓冲，实例数累加到间接绘制命令中，
+// 随后几何阶段用 glMultiDrawElementsIndirect 画出全部可见物体，CPU 不需要知道可见数量。
+// 工作组内先在共享内存中累计，每个工作组只对全局计数做一次 atomicAdd。
+//
+// 遮挡剔除分两个阶段 (phase):
+//   0: 只做视锥体剔除，结果写入命令 0
+//   1: 视锥体内、且上一帧判定为可见的物体写入命令 0 (画完后用 G-buffer 深度构建 Hi-Z)
+//   2: 视锥体内的全部物体与本帧的 Hi-Z 比较，结果写回可见性标志供下一帧使用；
+//      未被遮挡、且第 1 阶段没有画过的物体写入命令 1，接在命令 0 的实例之后
+#define GROUP_SIZE 64
+
+layout (local_size_x = GROUP_SIZE) in;
+
+// 与 gpu_culling.h 中的 DrawElementsIndirectCommand 一致
+struct DrawCommand
+{
+    uint Count;
+    uint InstanceCount;
+    uint FirstIndex;
+    int BaseVertex;
+    uint BaseInstance;
+};
+
+layout (std430, binding = 0) readonly buffer ObjectBuffer
+{
+    mat4 models[];
+};
+layout (std430, binding = 1) writeonly buffer VisibleBuffer
+{
+    mat4 visibleModels[];
+};
+layout (std430, binding = 2) buffer CommandBuffer
+{
+    DrawCommand commands[2];
+};
+#ifdef PRECOMPUTED_NORMAL_MATRIX
+// mat3 在 std430 中按 vec4 对齐，这里按 9 个 float 紧密存放，与顶点属性 7..9 的布局一致
+layout (std430, binding = 3) readonly buffer NormalBuffer
+{
+    float normals[];
+};
+layout (std430, binding = 4) writeonly buffer VisibleNormalBuffer
+{
+    float visibleNormals[];
+};
+#endif
+#ifdef OCCLUSION_CULLING
+layout (std430, binding = 5) buffer VisibilityBuffer
+{
+    uint visibility[]; // 上一帧第 2 阶段的结果: 1 为可见
+};
+uniform sampler2D hiZ;       // R32F，每级纹素为覆盖像素的最大深度
+uniform ivec2 hiZSize;       // 第 0 级尺寸
+uniform int hiZLevels;
+uniform mat4 viewProjection;
+#endif
+// 统计: 0 视锥体外的物体数, 1 被遮挡的物体数 (第 0、2 阶段累计)
+layout (std430, binding = 6) buffer CounterBuffer
+{
+    uint counters[2];
+};
+
+uniform int phase;
+uniform uint objectCount;
+uniform vec4 frustumPlanes[6]; // 已归一化，内侧满足 dot(n, p) + d >= 0
+uniform vec3 boundsCenter;     // 网格的局部包围盒
+uniform vec3 boundsExtent;
+
+shared uint groupVisible;
+shared uint groupBase;
+shared uint groupOutside;
+shared uint groupOccluded;
+
+bool insideFrustum(vec3 center, vec3 extent)
+{
+    for (int i = 0; i < 6; ++i)
+    {
+        vec4 plane = frustumPlanes[i];
+        if (dot(plane.xyz, center) + plane.w < -dot(abs(plane.xyz), extent))
+            return false;
+    }
+    return true;
+}
+
+#ifdef OCCLUSION_CULLING
+// 包围盒的屏幕矩形和最近深度与 Hi-Z 比较: 选择矩形最多覆盖 2x2 纹素的层级，
+// 最近深度比这些纹素的最大深度还远时整个包围盒都被挡住
+bool occluded(vec3 center, vec3 extent)
+{
+    vec2 rectMin = vec2(1.0);
+    vec2 rectMax = vec2(-1.0);
+    float nearest = 1.0;
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        vec3 offset = vec3((corner & 1) != 0 ? 1.0 : -1.0, (corner & 2) != 0 ? 1.0 : -1.0, (corner & 4) != 0 ? 1.0 : -1.0);
+        vec4 clip = viewProjection * vec4(center + offset * extent, 1.0);
+        if (clip.w <= 0.0) // 包围盒跨过摄像机平面，无法投影，保守地认为可见
+            return false;
+        vec3 ndc = clip.xyz / clip.w;
+        rectMin = min(rectMin, ndc.xy);
+        rectMax = max(rectMax, ndc.xy);
+        nearest = min(nearest, ndc.z * 0.5 + 0.5);
+    }
+    vec2 size0 = vec2(hiZSize);
+    vec2 pixelMin = clamp(rectMin * 0.5 + 0.5, 0.0, 1.0) * size0;
+    vec2 pixelMax = clamp(rectMax * 0.5 + 0.5, 0.0, 1.0) * size0;
+    vec2 extentPixels = max(pixelMax - pixelMin, vec2(1.0));
+    int level = clamp(int(ceil(log2(max(extentPixels.x, extentPixels.y)))), 0, hiZLevels - 1);
+    ivec2 levelMax = max(hiZSize >> level, ivec2(1)) - 1; // 与 glTexStorage2D 的各级尺寸一致
+    // 奇数尺寸时每级最后一行/列包含了上一级多出的像素，所以钳制到最后一个纹素是保守的
+    ivec2 first = min(ivec2(pixelMin) >> level, levelMax);
+    ivec2 last = min(ivec2(min(pixelMax, size0 - 1.0)) >> level, levelMax);
+    float farthest = 0.0;
+    for (int y = first.y; y <= last.y; ++y)
+        for (int x = first.x; x <= last.x; ++x)
+            farthest = max(farthest, texelFetch(hiZ, ivec2(x, y), level).r);
+    return nearest > farthest;
+}
+#endif
+
+void main()
+{
+    if (gl_LocalInvocationIndex == 0)
+    {
+        groupVisible = 0u;
+        groupOutside = 0u;
+        groupOccluded = 0u;
+    }
+    barrier();
+
+    uint object = gl_GlobalInvocationID.x;
+    mat4 model = mat4(1.0);
+    bool visible = false;
+    uint localSlot = 0u;
+    if (object < objectCount)
+    {
+        model = models[object];
+        vec3 center = (model * vec4(boundsCenter, 1.0)).xyz;
+        vec3 extent = abs(model[0].xyz) * boundsExtent.x + abs(model[1].xyz) * boundsExtent.y + abs(model[2].xyz) * boundsExtent.z;
+        visible = insideFrustum(center, extent);
+        if (!visible && phase != 1)
+            atomicAdd(groupOutside, 1u);
+#ifdef OCCLUSION_CULLING
+        if (phase == 1)
+            visible = visible && visibility[object] != 0u;
+        else if (phase == 2)
+        {
+            bool drawnInPhase1 = visible && visibility[object] != 0u;
+            if (visible && occluded(center, extent))
+            {
+                visible = false;
+                atomicAdd(groupOccluded, 1u);
+            }
+            visibility[object] = visible ? 1u : 0u;
+            visible = visible && !drawnInPhase1;
+        }
+#endif
+        if (visible)
+            localSlot = atomicAdd(groupVisible, 1u);
+    }
+    barrier();
+
+    // 第 2 阶段的实例接在第 1 阶段之后 (第 1 阶段的数量此时已经确定)
+    uint command = phase == 2 ? 1u : 0u;
+    if (gl_LocalInvocationIndex == 0)
+    {
+        uint offset = phase == 2 ? commands[0].InstanceCount : 0u;
+        groupBase = offset + (groupVisible > 0u ? atomicAdd(commands[command].InstanceCount, groupVisible) : 0u);
+        if (phase == 2 && gl_WorkGroupID.x == 0u)
+            commands[1].BaseInstance = offset;
+        if (groupOutside > 0u)
+            atomicAdd(counters[0], groupOutside);
+        if (groupOccluded > 0u)
+            atomicAdd(counters[1], groupOccluded);
+    }
+    barrier();
+
+    if (!visible)
+        return;
+    uint slot = groupBase + localSlot;
+    visibleModels[slot] = model;
+#ifdef PRECOMPUTED_NORMAL_MATRIX
+    for (uint i = 0u; i < 9u; ++i)
+        visibleNormals[slot * 9u + i] = normals[object * 9u + i];
+#endif
+}
@@ -0,0 +1,310 @@
+#ifndef GPU_CULLING_H
+#define GPU_CULLING_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "hiz_pyramid.h"
+#include "instanced_scene.h"
+#include "mesh.h"
+#include "normal_matrix.h"
+#include "scene_bvh.h"
+#include "shader_m.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// glMultiDrawElementsIndirect 读取的命令格式 (与 gpu_culling.cs 中的 DrawCommand 一致)
+struct DrawElementsIndirectCommand
+{
+    GLuint Count;
+    GLuint InstanceCount;
+    GLuint FirstIndex;
+    GLint BaseVertex;
+    GLuint BaseInstance;
+};
+
+// GPU 驱动的剔除 (计算着色器 + 间接绘制，需要 GL 4.3)
+// 几何阶段的全部物体 (单独绘制的场景物体在前，实例化场景的实例在后) 的模型矩阵常驻一个 SSBO，
+// 运动物体每帧只更新自己的矩阵。gpu_culling.cs 每帧对所有物体做视锥体测试，把可见物体的矩阵紧凑地写入
+// 输出缓冲并累加间接绘制命令的实例数；输出缓冲直接作为实例属性 (与 InstancedScene 相同的布局)，
+// 整个几何阶段只需一次 glMultiDrawElementsIndirect，CPU 的提交开销与物体数量无关。
+// 所有物体共用立方体网格，所以每个阶段只有一条绘制命令；统计数据通过环形回读缓冲延迟几帧读回 CPU。
+//
+// 遮挡剔除 (两阶段 Hi-Z): 每个物体保存上一帧的可见性标志。
+//   Cull: 先画上一帧可见、且在本帧视锥体内的物体 (Draw(0))
+//   调用方用这时的 G-buffer 深度构建 Hi-Z (HiZPyramid::Build)
+//   CullOccluded: 视锥体内的全部物体与 Hi-Z 比较并更新标志，第一阶段漏掉的新可见物体由 Draw(1) 补画
+// 上一帧的可见集合通常就是本帧遮挡物的很好近似，而第二阶段保证新出现的物体当帧就能画出，不会闪烁。
+class GpuCulling
+{
+public:
+    static const int GroupSize = 64;      // 与 gpu_culling.cs 中的 GROUP_SIZE 一致
+    static const int ReadbackLatency = 4; // 可见数量回读的延迟帧数 (同 GpuProfiler::FrameLatency)
+
+    Shader Program;
+    unsigned int ObjectSSBO = 0;         // 全部物体的模型矩阵
+    unsigned int NormalSSBO = 0;         // 全部物体的法线矩阵 (预计算模式)
+    unsigned int VisibleSSBO = 0;        // 可见物体的模型矩阵 (同时是实例属性缓冲)
+    unsigned int VisibleNormalSSBO = 0;  // 可见物体的法线矩阵
+    unsigned int CommandBuffer = 0;      // GL_DRAW_INDIRECT_BUFFER: 两个阶段各一条命令
+    unsigned int VisibilitySSBO = 0;     // 每个物体上一帧的可见性 (遮挡剔除)
+    unsigned int CounterSSBO = 0;        // 视锥体外/被遮挡的物体数
+    unsigned int VAO = 0;
+    int ObjectCount = 0;
+    bool OcclusionCulling = false;
+    // 统计 (只累计已回读的帧)
+    int VisibleCount = 0; // 最近一次回读到的绘制数量 (落后 ReadbackLatency - 1 帧)
+    long long VisibleTotal = 0;
+    long long SecondPhaseTotal = 0; // 其中由第二阶段补画的数量
+    long long FrustumCulledTotal = 0;
+    long long OccludedTotal = 0;
+    int Frames = 0;
+
+    // sceneModels: 单独绘制的场景物体 (占用下标 0..sceneModels.size()-1)，之后是 scene 的全部实例
+    // localBounds: 网格的局部包围盒；precomputeNormals 时 scene 的法线矩阵必须已经计算好
+    // occlusionCulling: 启用两阶段 Hi-Z 遮挡剔除 (需要调用方每帧构建 HiZPyramid)
+    // 不支持计算着色器或编译失败时返回 false，调用方回退到 CPU 剔除
+    bool Create(const Mesh& mesh, const std::vector<glm::mat4>& sceneModels, const InstancedScene& scene,
+                const Aabb& localBounds, bool precomputeNormals, bool occlusionCulling)
+    {
+        if (!GLAD_GL_VERSION_4_3)
+        {
+            std::cout << "ERROR::GPU_CULLING::REQUIRES_GL_4_3" << std::endl;
+            return false;
+        }
+        std::string defines;
+        if (precomputeNormals)
+            defines += "#define PRECOMPUTED_NORMAL_MATRIX\n";
+        if (occlusionCulling)
+            defines += "#define OCCLUSION_CULLING\n";
+        Program = Shader::Compute("../gpu_culling.cs", defines);
+        if (Program.ID == 0)
+            return false;
+        OcclusionCulling = occlusionCulling;
+        if (OcclusionCulling)
+        {
+            Program.use();
+            Program.setInt("hiZ", HiZPyramid::TextureUnit);
+        }
+        cubeMesh = &mesh;
+        bounds = localBounds;
+        sceneObjectCount = static_cast<int>(sceneModels.size());
+        ObjectCount = sceneObjectCount + static_cast<int>(scene.Transforms.size());
+
+        std::vector<glm::mat4> models(sceneModels);
+        models.insert(models.end(), scene.Transforms.begin(), scene.Transforms.end());
+        glGenBuffers(1, &ObjectSSBO);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, ObjectSSBO);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, models.size() * sizeof(glm::mat4), models.data(), GL_DYNAMIC_DRAW);
+        glGenBuffers(1, &VisibleSSBO);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, VisibleSSBO);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, models.size() * sizeof(glm::mat4), nullptr, GL_DYNAMIC_COPY);
+        if (precomputeNormals)
+        {
+            std::vector<glm::mat3> normals(models.size());
+            for (int object = 0; object < sceneObjectCount; ++object)
+                normals[object] = ComputeNormalMatrix(sceneModels[object]);
+            std::copy(scene.NormalMatrices.begin(), scene.NormalMatrices.end(), normals.begin() + sceneObjectCount);
+            glGenBuffers(1, &NormalSSBO);
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, NormalSSBO);
+            glBufferData(GL_SHADER_STORAGE_BUFFER, normals.size() * sizeof(glm::mat3), normals.data(), GL_DYNAMIC_DRAW);
+            glGenBuffers(1, &VisibleNormalSSBO);
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, VisibleNormalSSBO);
+            glBufferData(GL_SHADER_STORAGE_BUFFER, normals.size() * sizeof(glm::mat3), nullptr, GL_DYNAMIC_COPY);
+        }
+        if (OcclusionCulling)
+        {
+            // 第一帧没有历史，全部物体都留给第二阶段测试
+            std::vector<GLuint> visibility(models.size(), 0);
+            glGenBuffers(1, &VisibilitySSBO);
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, VisibilitySSBO);
+            glBufferData(GL_SHADER_STORAGE_BUFFER, visibility.size() * sizeof(GLuint), visibility.data(), GL_DYNAMIC_COPY);
+        }
+        glGenBuffers(1, &CounterSSBO);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, CounterSSBO);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, 2 * sizeof(GLuint), nullptr, GL_DYNAMIC_COPY);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+        glGenBuffers(1, &CommandBuffer);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, CommandBuffer);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, 2 * sizeof(DrawElementsIndirectCommand), nullptr, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        glGenBuffers(ReadbackLatency, readbackBuffers);
+        for (unsigned int buffer : readbackBuffers)
+        {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+            glBufferData(GL_COPY_WRITE_BUFFER, ReadbackValues * sizeof(GLuint), nullptr, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        VAO = CreateInstanceVertexArray(mesh, VisibleSSBO, VisibleNormalSSBO);
+        return true;
+    }
+
+    void Destroy()
+    {
+        if (Program.ID != 0)
+            glDeleteProgram(Program.ID);
+        glDeleteBuffers(1, &ObjectSSBO);
+        glDeleteBuffers(1, &NormalSSBO);
+        glDeleteBuffers(1, &VisibleSSBO);
+        glDeleteBuffers(1, &VisibleNormalSSBO);
+        glDeleteBuffers(1, &CommandBuffer);
+        glDeleteBuffers(1, &VisibilitySSBO);
+        glDeleteBuffers(1, &CounterSSBO);
+        glDeleteBuffers(ReadbackLatency, readbackBuffers);
+        glDeleteVertexArrays(1, &VAO);
+        Program.ID = 0;
+        ObjectSSBO = NormalSSBO = VisibleSSBO = VisibleNormalSSBO = CommandBuffer = VisibilitySSBO = CounterSSBO = VAO = 0;
+        for (unsigned int& buffer : readbackBuffers)
+            buffer = 0;
+        cubeMesh = nullptr;
+        ObjectCount = 0;
+        OcclusionCulling = false;
+    }
+
+    // 运动物体: 只更新它自己的模型矩阵 (和法线矩阵)
+    void UpdateObject(int object, const glm::mat4& model)
+    {
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, ObjectSSBO);
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, object * sizeof(glm::mat4), sizeof(glm::mat4), &model);
+        if (NormalSSBO != 0)
+        {
+            glm::mat3 normal = ComputeNormalMatrix(model);
+            glBindBuffer(GL_SHADER_STORAGE_BUFFER, NormalSSBO);
+            glBufferSubData(GL_SHADER_STORAGE_BUFFER, object * sizeof(glm::mat3), sizeof(glm::mat3), &normal);
+        }
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    }
+
+    // 剔除前 instances 个实例和全部场景物体，生成本帧 (第一阶段) 的间接绘制命令
+    void Cull(const Frustum& frustum, int instances)
+    {
+        CPU_PROFILE_SCOPE("gpu_culling");
+        // 两条命令的实例数和统计计数清零，其余字段描述整个网格
+        DrawElementsIndirectCommand commands[2];
+        for (DrawElementsIndirectCommand& command : commands)
+            command = { static_cast<GLuint>(cubeMesh->IndexCount), 0, 0, 0, 0 };
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, CommandBuffer);
+        glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, sizeof(commands), commands);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        const GLuint zero[2] = { 0, 0 };
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, CounterSSBO);
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(zero), zero);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+        dispatch(OcclusionCulling ? 1 : 0, frustum, instances);
+        if (!OcclusionCulling)
+            readback();
+    }
+
+    // 第二阶段: 用本帧第一阶段画完后构建的 Hi-Z 测试视锥体内的全部物体，生成补画命令 (Draw(1))
+    void CullOccluded(const Frustum& frustum, const glm::mat4& viewProjection, const HiZPyramid& hiZ, int instances)
+    {
+        CPU_PROFILE_SCOPE("gpu_culling_occlusion");
+        Program.use();
+        Program.setMat4("viewProjection", viewProjection);
+        glUniform2i(glGetUniformLocation(Program.ID, "hiZSize"), hiZ.Size.x, hiZ.Size.y);
+        Program.setInt("hiZLevels", hiZ.Levels);
+        hiZ.Bind();
+        dispatch(2, frustum, instances);
+        readback();
+    }
+
+    // 画指定阶段的可见物体 (调用方已经 use() 了 INSTANCED 变体的着色器并设置好 view/projection)
+    void Draw(int phase = 0) const
+    {
+        CPU_PROFILE_SCOPE("gpu_culling_draw");
+        glBindVertexArray(VAO);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, CommandBuffer);
+        glMultiDrawElementsIndirect(GL_TRIANGLES, cubeMesh->IndexType, (void*)(phase * sizeof(DrawElementsIndirectCommand)), 1, 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        glBindVertexArray(0);
+    }
+
+    void PrintSummary() const
+    {
+        if (Frames == 0)
+            return;
+        std::cout << "GPU culling: " << ObjectCount << " objects, avg " << VisibleTotal / Frames << " drawn";
+        if (OcclusionCulling)
+            std::cout << " (" << SecondPhaseTotal / Frames << " in the second phase)";
+        std::cout << ", " << FrustumCulledTotal / Frames << " outside the frustum";
+        if (OcclusionCulling)
+            std::cout << ", " << OccludedTotal / Frames << " occluded";
+        std::cout << " (" << Frames << " frames read back)" << std::endl;
+    }
+
+private:
+    const Mesh* cubeMesh = nullptr;
+    Aabb bounds;
+    int sceneObjectCount = 0;
+    static const int ReadbackValues = 4; // 两条命令的实例数 + 两个统计计数
+    unsigned int readbackBuffers[ReadbackLatency] = {};
+    int frame = 0;
+
+    void dispatch(int phase, const Frustum& frustum, int instances)
+    {
+        int objects = std::min(sceneObjectCount + std::max(instances, 0), ObjectCount);
+        Program.use();
+        Program.setInt("phase", phase);
+        glUniform1ui(glGetUniformLocation(Program.ID, "objectCount"), static_cast<GLuint>(objects));
+        glUniform4fv(glGetUniformLocation(Program.ID, "frustumPlanes"), 6, &frustum.Planes[0][0]);
+        Program.setVec3("boundsCenter", bounds.Center());
+        Program.setVec3("boundsExtent", (bounds.Max - bounds.Min) * 0.5f);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, ObjectSSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, VisibleSSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, CommandBuffer);
+        if (NormalSSBO != 0)
+        {
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, NormalSSBO);
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 4, VisibleNormalSSBO);
+        }
+        if (VisibilitySSBO != 0)
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 5, VisibilitySSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 6, CounterSSBO);
+        if (objects > 0)
+            glDispatchCompute((objects + GroupSize - 1) / GroupSize, 1, 1);
+        // 计算着色器写入的命令和实例数据要对间接绘制、顶点属性读取、下一阶段和回读拷贝可见
+        glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT |
+                        GL_BUFFER_UPDATE_BARRIER_BIT);
+    }
+
+    // 先读出 ReadbackLatency 帧之前拷入这个槽位的统计，再拷入本帧的
+    void readback()
+    {
+        const GLintptr instanceCount = offsetof(DrawElementsIndirectCommand, InstanceCount);
+        int slot = frame % ReadbackLatency;
+        glBindBuffer(GL_COPY_WRITE_BUFFER, readbackBuffers[slot]);
+        if (frame >= ReadbackLatency)
+            collect();
+        glBindBuffer(GL_COPY_READ_BUFFER, CommandBuffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, instanceCount, 0, sizeof(GLuint));
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, sizeof(DrawElementsIndirectCommand) + instanceCount,
+                            sizeof(GLuint), sizeof(GLuint));
+        glBindBuffer(GL_COPY_READ_BUFFER, CounterSSBO);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 2 * sizeof(GLuint), 2 * sizeof(GLuint));
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+        ++frame;
+    }
+
+    // 读取绑定在 GL_COPY_WRITE_BUFFER 上的回读缓冲 (ReadbackLatency 帧之前写入，通常不会等待 GPU)
+    void collect()
+    {
+        GLuint values[ReadbackValues] = {};
+        glGetBufferSubData(GL_COPY_WRITE_BUFFER, 0, sizeof(values), values);
+        VisibleCount = static_cast<int>(values[0] + values[1]);
+        VisibleTotal += VisibleCount;
+        SecondPhaseTotal += values[1];
+        FrustumCulledTotal += values[2];
+        OccludedTotal += values[3];
+        ++Frames;
+    }
+};
+
+#endif
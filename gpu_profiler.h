@@ -0,0 +1,209 @@
+#ifndef GPU_PROFILER_H
+#define GPU_PROFILER_H
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 按渲染阶段(pass)统计 GPU 耗时的分析器
+// 每个 pass 在开始和结束处各插入一个 GL_TIMESTAMP 查询 (glQueryCounter)，
+// 查询对象按帧做成环形缓冲: 第 N 帧写入的查询要到第 N + FrameLatency 帧才读取，
+// 那时结果早已就绪，读取不会让 CPU 等待 GPU。
+// 与 GL_TIME_ELAPSED 不同，时间戳查询可以嵌套和交错，也能和 FrameTimer 同时使用。
+class GpuProfiler
+{
+public:
+    // 环形缓冲的帧数，即读取结果的延迟帧数
+    static const int FrameLatency = 4;
+    // 滚动平均/p99 统计的窗口大小 (帧)
+    static const int WindowSize = 240;
+
+    // 是否保留完整的逐帧历史 (WriteCsv 需要)；长时间交互运行时关闭以免内存增长
+    bool RecordHistory = false;
+
+    struct PassStats
+    {
+        double LastMs = 0.0;
+        double AvgMs = 0.0;
+        double P99Ms = 0.0;
+    };
+
+    // 注册一个 pass，返回其索引；需在第一次 BeginFrame 之前调用
+    int RegisterPass(const std::string& name)
+    {
+        Pass pass;
+        pass.Name = name;
+        glGenQueries(FrameLatency * 2, pass.Queries);
+        passes.push_back(pass);
+        return static_cast<int>(passes.size()) - 1;
+    }
+
+    // 需要在 OpenGL 上下文销毁前调用
+    void Destroy()
+    {
+        for (Pass& pass : passes)
+            glDeleteQueries(FrameLatency * 2, pass.Queries);
+        passes.clear();
+    }
+
+    void BeginFrame()
+    {
+        slot = frameCount % FrameLatency;
+        // 先读取 FrameLatency 帧之前写入这个槽位的结果
+        if (frameCount >= FrameLatency)
+            collect(slot, frameCount - FrameLatency);
+        for (Pass& pass : passes)
+            pass.Issued[slot] = false;
+    }
+
+    void BeginPass(int index)
+    {
+        glQueryCounter(passes[index].Queries[slot * 2], GL_TIMESTAMP);
+    }
+
+    void EndPass(int index)
+    {
+        glQueryCounter(passes[index].Queries[slot * 2 + 1], GL_TIMESTAMP);
+        passes[index].Issued[slot] = true;
+    }
+
+    void EndFrame()
+    {
+        ++frameCount;
+    }
+
+    // 运行结束时读取所有尚未读取的结果 (会等待 GPU)
+    void Finish()
+    {
+        for (long long frame = std::max(0LL, frameCount - FrameLatency); frame < frameCount; ++frame)
+            collect(static_cast<int>(frame % FrameLatency), frame);
+    }
+
+    int PassCount() const { return static_cast<int>(passes.size()); }
+    const std::string& PassName(int index) const { return passes[index].Name; }
+
+    // 滚动窗口内的统计结果
+    PassStats GetStats(int index) const
+    {
+        PassStats stats;
+        const Pass& pass = passes[index];
+        if (pass.Window.empty())
+            return stats;
+        std::vector<double> sorted = pass.Window;
+        std::sort(sorted.begin(), sorted.end());
+        double sum = 0.0;
+        for (double v : sorted)
+            sum += v;
+        stats.LastMs = pass.LastMs;
+        stats.AvgMs = sum / sorted.size();
+        stats.P99Ms = sorted[std::min(sorted.size() - 1, static_cast<size_t>(sorted.size() * 0.99))];
+        return stats;
+    }
+
+    // 单行文本，例如 "geometry 0.12/0.30 | lighting 0.40/0.52 (avg/p99 ms)"
+    std::string FormatStats() const
+    {
+        std::ostringstream out;
+        out.setf(std::ios::fixed);
+        out.precision(2);
+        for (int i = 0; i < PassCount(); ++i)
+        {
+            PassStats stats = GetStats(i);
+            if (i > 0)
+                out << " | ";
+            out << passes[i].Name << " " << stats.AvgMs << "/" << stats.P99Ms;
+        }
+        out << " (avg/p99 ms)";
+        return out.str();
+    }
+
+    void PrintSummary() const
+    {
+        std::cout << "GPU passes (last " << WindowSize << " frames):" << std::endl;
+        for (int i = 0; i < PassCount(); ++i)
+        {
+            PassStats stats = GetStats(i);
+            std::cout << "  " << passes[i].Name << ": avg " << stats.AvgMs
+                      << " ms, p99 " << stats.P99Ms << " ms" << std::endl;
+        }
+    }
+
+    // 导出每帧每个 pass 的耗时，-1 表示该帧没有执行这个 pass
+    bool WriteCsv(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file.is_open())
+        {
+            std::cout << "ERROR::GPU_PROFILER::CSV_OPEN_FAILED: " << path << std::endl;
+            return false;
+        }
+        file << "frame";
+        for (const Pass& pass : passes)
+            file << "," << pass.Name << "_ms";
+        file << "\n";
+        for (size_t frame = 0; frame < history.size(); ++frame)
+        {
+            file << frame;
+            for (double ms : history[frame])
+                file << "," << ms;
+            file << "\n";
+        }
+        std::cout << "GPU pass times written to " << path << std::endl;
+        return true;
+    }
+
+private:
+    struct Pass
+    {
+        std::string Name;
+        // 每个槽位两个时间戳查询: [slot * 2] 开始，[slot * 2 + 1] 结束
+        unsigned int Queries[FrameLatency * 2];
+        bool Issued[FrameLatency] = {};
+        double LastMs = 0.0;
+        std::vector<double> Window; // 滚动窗口，环形写入
+        size_t WindowHead = 0;
+    };
+
+    std::vector<Pass> passes;
+    // 完整的逐帧历史，用于导出
+    std::vector<std::vector<double>> history;
+    long long frameCount = 0;
+    int slot = 0;
+
+    void collect(int querySlot, long long frame)
+    {
+        if (RecordHistory && history.size() <= static_cast<size_t>(frame))
+            history.resize(frame + 1, std::vector<double>(passes.size(), -1.0));
+        for (size_t i = 0; i < passes.size(); ++i)
+        {
+            Pass& pass = passes[i];
+            if (!pass.Issued[querySlot])
+                continue;
+            GLuint64 begin = 0, end = 0;
+            glGetQueryObjectui64v(pass.Queries[querySlot * 2], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(pass.Queries[querySlot * 2 + 1], GL_QUERY_RESULT, &end);
+            pass.Issued[querySlot] = false;
+
+            double ms = static_cast<double>(end - begin) / 1.0e6;
+            pass.LastMs = ms;
+            if (RecordHistory)
+                history[frame][i] = ms;
+            if (pass.Window.size() < static_cast<size_t>(WindowSize))
+            {
+                pass.Window.push_back(ms);
+            }
+            else
+            {
+                pass.Window[pass.WindowHead] = ms;
+                pass.WindowHead = (pass.WindowHead + 1) % WindowSize;
+            }
+        }
+    }
+};
+
+#endif
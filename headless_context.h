@@ -0,0 +1,103 @@
+#ifndef HEADLESS_CONTEXT_H
+#define HEADLESS_CONTEXT_H
+
+// 无窗口 OpenGL 上下文 (EGL surfaceless)
+// 用于在没有显示器的构建机上跑基准测试，Mesa 的 llvmpipe 软件光栅化也能用。
+// 上下文没有默认帧缓冲，所有渲染都必须画到自己创建的 FBO 上。
+#ifdef HEADLESS_EGL
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <iostream>
+
+class HeadlessContext
+{
+public:
+    EGLDisplay Display = EGL_NO_DISPLAY;
+    EGLContext Context = EGL_NO_CONTEXT;
+
+    // 创建指定版本的 core profile 上下文并设为当前上下文
+    bool Create(int major, int minor)
+    {
+        // 优先使用 Mesa 的 surfaceless 平台，不依赖 X11/Wayland
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (getPlatformDisplay)
+            Display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+        if (Display == EGL_NO_DISPLAY)
+            Display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (Display == EGL_NO_DISPLAY)
+        {
+            std::cout << "ERROR::EGL::NO_DISPLAY" << std::endl;
+            return false;
+        }
+
+        EGLint eglMajor, eglMinor;
+        if (!eglInitialize(Display, &eglMajor, &eglMinor))
+        {
+            std::cout << "ERROR::EGL::INITIALIZE_FAILED" << std::endl;
+            return false;
+        }
+        if (!eglBindAPI(EGL_OPENGL_API))
+        {
+            std::cout << "ERROR::EGL::BIND_OPENGL_API_FAILED" << std::endl;
+            return false;
+        }
+
+        // 不需要任何 surface，EGL_SURFACE_TYPE 置 0 表示接受所有配置
+        const EGLint configAttribs[] = {
+            EGL_SURFACE_TYPE, 0,
+            EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+            EGL_NONE
+        };
+        EGLConfig config;
+        EGLint numConfigs = 0;
+        if (!eglChooseConfig(Display, configAttribs, &config, 1, &numConfigs) || numConfigs == 0)
+        {
+            std::cout << "ERROR::EGL::NO_CONFIG" << std::endl;
+            return false;
+        }
+
+        const EGLint contextAttribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, major,
+            EGL_CONTEXT_MINOR_VERSION, minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_NONE
+        };
+        Context = eglCreateContext(Display, config, EGL_NO_CONTEXT, contextAttribs);
+        if (Context == EGL_NO_CONTEXT)
+        {
+            std::cout << "ERROR::EGL::CREATE_CONTEXT_FAILED" << std::endl;
+            return false;
+        }
+        // EGL_KHR_surfaceless_context: 不绑定任何 surface
+        if (!eglMakeCurrent(Display, EGL_NO_SURFACE, EGL_NO_SURFACE, Context))
+        {
+            std::cout << "ERROR::EGL::MAKE_CURRENT_FAILED (surfaceless context unsupported?)" << std::endl;
+            return false;
+        }
+        std::cout << "Headless EGL " << eglMajor << "." << eglMinor << " context created" << std::endl;
+        return true;
+    }
+
+    void Destroy()
+    {
+        if (Display == EGL_NO_DISPLAY)
+            return;
+        eglMakeCurrent(Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        if (Context != EGL_NO_CONTEXT)
+            eglDestroyContext(Display, Context);
+        eglTerminate(Display);
+        Display = EGL_NO_DISPLAY;
+        Context = EGL_NO_CONTEXT;
+    }
+
+    // 供 gladLoadGLLoader 使用的函数加载器
+    static void* GetProcAddress(const char* name)
+    {
+        return (void*)eglGetProcAddress(name);
+    }
+};
+
+#endif // HEADLESS_EGL
+#endif
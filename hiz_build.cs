@@ -0,0 +1,40 @@
+// 文件名: hiz_build.cs
+#version 430 core
+// 分层深度 (Hi-Z) 金字塔的构建
+// 第 0 级直接复制 G-buffer 的深度，之后每一级的纹素取上一级对应 2x2 纹素的最大深度 (最远)，
+// 所以任意一级的纹素都是它覆盖的全部像素深度的保守上界。
+// 上一级尺寸为奇数时，本级最后一行/列的纹素额外包含上一级多出的那一行/列，不会漏掉边缘像素。
+#define GROUP_SIZE 8
+
+layout (local_size_x = GROUP_SIZE, local_size_y = GROUP_SIZE) in;
+
+uniform bool copyDepth;          // true: 从深度纹理生成第 0 级
+uniform sampler2D depthTexture;  // G-buffer 深度 (只在 copyDepth 时读取)
+layout (r32f, binding = 0) uniform readonly image2D sourceLevel;
+layout (r32f, binding = 1) uniform writeonly image2D targetLevel;
+uniform ivec2 sourceSize;
+uniform ivec2 targetSize;
+
+void main()
+{
+    ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+    if (texel.x >= targetSize.x || texel.y >= targetSize.y)
+        return;
+    if (copyDepth)
+    {
+        imageStore(targetLevel, texel, vec4(texelFetch(depthTexture, texel, 0).r));
+        return;
+    }
+    ivec2 first = texel * 2;
+    ivec2 last = first + 1;
+    if (texel.x == targetSize.x - 1 && (sourceSize.x & 1) != 0)
+        last.x += 1;
+    if (texel.y == targetSize.y - 1 && (sourceSize.y & 1) != 0)
+        last.y += 1;
+    last = min(last, sourceSize - 1);
+    float depth = 0.0;
+    for (int y = first.y; y <= last.y; ++y)
+        for (int x = first.x; x <= last.x; ++x)
+            depth = max(depth, imageLoad(sourceLevel, ivec2(x, y)).r);
+    imageStore(targetLevel, texel, vec4(depth));
+}
@@ -0,0 +1,150 @@
+#ifndef HIZ_PYRAMID_H
+#define HIZ_PYRAMID_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "cpu_profiler.h"
+#include "gbuffer.h"
+#include "shader_m.h"
+
+#include <algorithm>
+#include <iostream>
+
+// 分层深度 (Hi-Z) 金字塔 (计算着色器，需要 GL 4.3)
+// 由 G-buffer 当前使用的子矩形 (GBuffer::Size) 的深度生成，保存为带完整 mip 链的 R32F 纹理，
+// 每个纹素是它覆盖的像素中的最大深度，遮挡测试只需读取包围盒屏幕矩形对应层级的 2x2 纹素。
+// G-buffer 深度是 renderbuffer 时 (classic 布局) 先 blit 到自己的深度纹理再采样。
+class HiZPyramid
+{
+public:
+    static const int GroupSize = 8;             // 与 hiz_build.cs 中的 GROUP_SIZE 一致
+    static const unsigned int TextureUnit = 14; // 构建和剔除时读取深度/金字塔的纹理单元 (点光源阴影占 12, 13)
+
+    Shader Program;
+    unsigned int Texture = 0;      // R32F，Levels 级 mip
+    unsigned int DepthTexture = 0; // classic 布局时的深度副本
+    unsigned int DepthFBO = 0;
+    glm::ivec2 Size = glm::ivec2(0);
+    int Levels = 0;
+
+    bool Create()
+    {
+        if (!GLAD_GL_VERSION_4_3)
+        {
+            std::cout << "ERROR::HIZ::REQUIRES_GL_4_3" << std::endl;
+            return false;
+        }
+        Program = Shader::Compute("../hiz_build.cs");
+        if (Program.ID == 0)
+            return false;
+        Program.use();
+        Program.setInt("depthTexture", TextureUnit);
+        return true;
+    }
+
+    void Destroy()
+    {
+        if (Program.ID != 0)
+            glDeleteProgram(Program.ID);
+        glDeleteTextures(1, &Texture);
+        glDeleteTextures(1, &DepthTexture);
+        glDeleteFramebuffers(1, &DepthFBO);
+        Program.ID = 0;
+        Texture = DepthTexture = DepthFBO = 0;
+        Size = glm::ivec2(0);
+        Levels = 0;
+    }
+
+    // 由本帧目前为止写入 G-buffer 的深度重建整个金字塔 (调用后 G-buffer 的 FBO 重新绑定为绘制目标)
+    void Build(const GBuffer& gBuffer)
+    {
+        CPU_PROFILE_SCOPE("hiz_build");
+        ensureStorage(gBuffer.Size);
+        unsigned int depth = gBuffer.Texture("gDepth");
+        if (depth == 0)
+        {
+            ensureDepthCopy(gBuffer.Size);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, gBuffer.FBO);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, DepthFBO);
+            glBlitFramebuffer(0, 0, Size.x, Size.y, 0, 0, Size.x, Size.y, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+            depth = DepthTexture;
+        }
+
+        Program.use();
+        glActiveTexture(GL_TEXTURE0 + TextureUnit);
+        glBindTexture(GL_TEXTURE_2D, depth);
+        glm::ivec2 source = Size;
+        for (int level = 0; level < Levels; ++level)
+        {
+            glm::ivec2 target = level == 0 ? Size : glm::max(source / 2, glm::ivec2(1));
+            Program.setBool("copyDepth", level == 0);
+            glUniform2i(glGetUniformLocation(Program.ID, "sourceSize"), source.x, source.y);
+            glUniform2i(glGetUniformLocation(Program.ID, "targetSize"), target.x, target.y);
+            if (level > 0)
+                glBindImageTexture(0, Texture, level - 1, GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+            glBindImageTexture(1, Texture, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+            glDispatchCompute((target.x + GroupSize - 1) / GroupSize, (target.y + GroupSize - 1) / GroupSize, 1);
+            // 下一级用 imageLoad 读取本级，剔除着色器用 texelFetch 读取
+            glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+            source = target;
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+        glActiveTexture(GL_TEXTURE0);
+        glBindFramebuffer(GL_FRAMEBUFFER, gBuffer.FBO);
+    }
+
+    // 把金字塔绑定到 TextureUnit，供剔除着色器读取
+    void Bind() const
+    {
+        glActiveTexture(GL_TEXTURE0 + TextureUnit);
+        glBindTexture(GL_TEXTURE_2D, Texture);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+private:
+    glm::ivec2 depthCopySize = glm::ivec2(0);
+
+    // 金字塔跟随 G-buffer 的使用尺寸 (而不是分配尺寸)，尺寸变化时重建
+    void ensureStorage(glm::ivec2 size)
+    {
+        if (size == Size && Texture != 0)
+            return;
+        Size = size;
+        Levels = 1;
+        for (int extent = std::max(size.x, size.y); extent > 1; extent /= 2)
+            ++Levels;
+        glDeleteTextures(1, &Texture);
+        glGenTextures(1, &Texture);
+        glBindTexture(GL_TEXTURE_2D, Texture);
+        glTexStorage2D(GL_TEXTURE_2D, Levels, GL_R32F, size.x, size.y);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    void ensureDepthCopy(glm::ivec2 size)
+    {
+        if (size == depthCopySize && DepthTexture != 0)
+            return;
+        depthCopySize = size;
+        glDeleteTextures(1, &DepthTexture);
+        glGenTextures(1, &DepthTexture);
+        glBindTexture(GL_TEXTURE_2D, DepthTexture);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH24_STENCIL8, size.x, size.y); // 与 G-buffer 相同的格式才能 blit
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        if (DepthFBO == 0)
+            glGenFramebuffers(1, &DepthFBO);
+        glBindFramebuffer(GL_FRAMEBUFFER, DepthFBO);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, DepthTexture, 0);
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+};
+
+#endif
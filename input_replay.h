@@ -0,0 +1,175 @@
+#ifndef INPUT_REPLAY_H
+#define INPUT_REPLAY_H
+
+#include <glm/glm.hpp>
+
+#include "camera.h"
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// 一帧内汇总的输入
+// 鼠标/滚轮回调只往这里累加偏移量，按键在 processInput 中置位，
+// 每帧统一通过 ApplyFrameInput 作用到 Camera 上，录制和回放走的是同一条路径。
+struct FrameInput
+{
+    uint8_t Keys = 0;     // 按 Camera_Movement 顺序的位掩码: 1 << FORWARD ...
+    float MouseDX = 0.0f; // 本帧鼠标偏移量累计 (与 ProcessMouseMovement 的参数一致)
+    float MouseDY = 0.0f;
+    float Scroll = 0.0f;  // 本帧滚轮偏移量累计
+
+    void Clear() { *this = FrameInput(); }
+};
+
+inline void ApplyFrameInput(Camera& camera, const FrameInput& input, float deltaTime)
+{
+    if (input.MouseDX != 0.0f || input.MouseDY != 0.0f)
+        camera.ProcessMouseMovement(input.MouseDX, input.MouseDY);
+    if (input.Scroll != 0.0f)
+        camera.ProcessMouseScroll(input.Scroll);
+    const Camera_Movement directions[] = { FORWARD, BACKWARD, LEFT, RIGHT };
+    for (Camera_Movement direction : directions)
+        if (input.Keys & (1 << direction))
+            camera.ProcessKeyboard(direction, deltaTime);
+}
+
+// 录制文件格式 (本机字节序，紧凑二进制；只在同一字节序的机器间通用):
+//   文件头: magic "GEIR" | uint32 版本 | uint32 帧数 | 初始摄像机 Position(3 x float) Yaw Pitch Zoom
+//   每帧:   float 录制时的 deltaTime | uint8 Keys | float MouseDX | float MouseDY | float Scroll  (17 字节)
+const uint32_t INPUT_RECORDING_MAGIC = 0x52494547; // "GEIR"
+const uint32_t INPUT_RECORDING_VERSION = 1;
+
+class InputRecorder
+{
+public:
+    bool Open(const std::string& path, const Camera& camera)
+    {
+        file.open(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::cout << "ERROR::INPUT_RECORDER::OPEN_FAILED: " << path << std::endl;
+            return false;
+        }
+        frameCount = 0;
+        write(INPUT_RECORDING_MAGIC);
+        write(INPUT_RECORDING_VERSION);
+        write(frameCount); // 占位，Close 时回填
+        write(camera.Position.x);
+        write(camera.Position.y);
+        write(camera.Position.z);
+        write(camera.Yaw);
+        write(camera.Pitch);
+        write(camera.Zoom);
+        std::cout << "Recording input to " << path << std::endl;
+        return true;
+    }
+
+    bool IsOpen() const { return file.is_open(); }
+
+    void Write(const FrameInput& input, float deltaTime)
+    {
+        write(deltaTime);
+        write(input.Keys);
+        write(input.MouseDX);
+        write(input.MouseDY);
+        write(input.Scroll);
+        ++frameCount;
+    }
+
+    void Close()
+    {
+        if (!file.is_open())
+            return;
+        // 回填帧数
+        file.seekp(2 * sizeof(uint32_t));
+        write(frameCount);
+        file.close();
+        std::cout << "Input recording finished: " << frameCount << " frames" << std::endl;
+    }
+
+private:
+    std::ofstream file;
+    uint32_t frameCount = 0;
+
+    template <typename T>
+    void write(const T& value)
+    {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+};
+
+class InputReplayer
+{
+public:
+    uint32_t FrameCount = 0;
+
+    // 打开录制文件并把摄像机恢复到录制开始时的状态
+    bool Open(const std::string& path, Camera& camera)
+    {
+        file.open(path, std::ios::binary);
+        if (!file.is_open())
+        {
+            std::cout << "ERROR::INPUT_REPLAYER::OPEN_FAILED: " << path << std::endl;
+            return false;
+        }
+        uint32_t magic = 0, version = 0;
+        read(magic);
+        read(version);
+        if (!file || magic != INPUT_RECORDING_MAGIC || version != INPUT_RECORDING_VERSION)
+        {
+            std::cout << "ERROR::INPUT_REPLAYER::BAD_HEADER: " << path << std::endl;
+            file.close();
+            return false;
+        }
+        read(FrameCount);
+        glm::vec3 position;
+        float yaw, pitch, zoom;
+        read(position.x);
+        read(position.y);
+        read(position.z);
+        read(yaw);
+        read(pitch);
+        read(zoom);
+        camera.SetPose(position, yaw, pitch);
+        camera.Zoom = zoom;
+        framesRead = 0;
+        std::cout << "Replaying " << FrameCount << " frames from " << path << std::endl;
+        return true;
+    }
+
+    bool IsOpen() const { return file.is_open(); }
+
+    // 读取下一帧输入，录制内容读完后返回 false
+    bool Next(FrameInput& input, float& recordedDeltaTime)
+    {
+        if (!file.is_open() || framesRead >= FrameCount)
+            return false;
+        read(recordedDeltaTime);
+        read(input.Keys);
+        read(input.MouseDX);
+        read(input.MouseDY);
+        read(input.Scroll);
+        if (!file)
+        {
+            std::cout << "ERROR::INPUT_REPLAYER::TRUNCATED at frame " << framesRead << std::endl;
+            FrameCount = framesRead;
+            return false;
+        }
+        ++framesRead;
+        return true;
+    }
+
+private:
+    std::ifstream file;
+    uint32_t framesRead = 0;
+
+    template <typename T>
+    void read(T& value)
+    {
+        file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+};
+
+#endif
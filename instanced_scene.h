@@ -0,0 +1,457 @@
+#ifndef INSTANCED_SCENE_H
+#define INSTANCED_SCENE_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "cpu_profiler.h"
+#include "mesh.h"
+#include "mesh_lod.h"
+#include "normal_matrix.h"
+#include "scene_bvh.h"
+#include "shader_m.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+// 实例属性: 实例矩阵 (每列一个 vec4 属性，每个实例前进一次) 和可选的法线矩阵，从第 firstInstance 个实例开始读取。
+// 调用前需要绑定目标 VAO；GL 3.3 没有 baseInstance，只画一段实例时用偏移重新指定属性指针
+inline void SetInstanceAttributes(unsigned int instanceVBO, unsigned int normalMatrixVBO, size_t firstInstance = 0)
+{
+    const int instanceMatrixLocation = 3; // mat4 占用 3, 4, 5, 6 四个属性位置 (与 basic_lighting.vs 一致)
+    const int normalMatrixLocation = 7;   // mat3 占用 7, 8, 9 三个属性位置
+    glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+    for (int column = 0; column < 4; ++column)
+    {
+        glEnableVertexAttribArray(instanceMatrixLocation + column);
+        glVertexAttribPointer(instanceMatrixLocation + column, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+                              (void*)(firstInstance * sizeof(glm::mat4) + column * sizeof(glm::vec4)));
+        glVertexAttribDivisor(instanceMatrixLocation + column, 1);
+    }
+    if (normalMatrixVBO != 0)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, normalMatrixVBO);
+        for (int column = 0; column < 3; ++column)
+        {
+            glEnableVertexAttribArray(normalMatrixLocation + column);
+            glVertexAttribPointer(normalMatrixLocation + column, 3, GL_FLOAT, GL_FALSE, sizeof(glm::mat3),
+                                  (void*)(firstInstance * sizeof(glm::mat3) + column * sizeof(glm::vec3)));
+            glVertexAttribDivisor(normalMatrixLocation + column, 1);
+        }
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+// 实例化绘制的 VAO: 网格属性 0..2 + 实例属性，normalMatrixVBO 为 0 时不设置法线矩阵属性。
+// InstancedScene 和 GPU 剔除的输出缓冲共用这套布局
+inline unsigned int CreateInstanceVertexArray(const Mesh& mesh, unsigned int instanceVBO, unsigned int normalMatrixVBO)
+{
+    unsigned int vao = 0;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    mesh.SetupAttributes(); // 位置/法线/纹理坐标 (属性 0..2)
+    SetInstanceAttributes(instanceVBO, normalMatrixVBO);
+    glBindVertexArray(0);
+    return vao;
+}
+
+// 实例化压力测试场景
+// 大量小立方体分布在以原点为中心的球壳格点上 (避开摄像机的运动范围)，按到原点的距离排序，
+// 实例数增长时从内向外添加。每个实例的模型矩阵存放在实例缓冲中，作为顶点属性 3..6 (divisor = 1)
+// 由 basic_lighting.vs 的 INSTANCED 变体读取，整个场景一次 glDrawElementsInstanced 画完。
+// 预计算法线矩阵时另用一个缓冲存放每个实例的 mat3，作为属性 7..9 上传 (PRECOMPUTED_NORMAL_MATRIX 变体)。
+// 开启剔除时 DrawVisible 把可见实例的矩阵紧凑地拷贝到每帧重写的流式缓冲，用另一个 VAO 绘制。
+// 遮挡查询按空间簇进行: CreateClusters 把实例按网格单元分组并按簇重新排列到另一组实例缓冲，DrawCluster 画其中一簇。
+// 连续 LOD: CreateLod 之后 DrawLod 按屏幕空间误差为每个实例选择 LOD 级别，每级一个流式实例缓冲，
+// 另带每个实例的交叉淡化系数 (属性 10，LOD_CROSSFADE 变体)。
+class InstancedScene
+{
+public:
+    constexpr static float Spacing = 1.2f;       // 格点间距
+    constexpr static float InnerRadius = 7.0f;   // 球壳内半径 (基准测试摄像机在半径 5 处绕行)
+    constexpr static float ClusterCellSize = 4.0f * Spacing; // 分簇的网格单元边长 (每簇最多约 64 个实例)
+
+    // 一簇实例在 ClusterInstances 中占连续的一段，簇内保持原来的实例顺序
+    struct Cluster
+    {
+        int First = 0;
+        int Count = 0;
+        Aabb Bounds; // 世界空间包围盒 (全部实例)
+    };
+
+    unsigned int VAO = 0;
+    unsigned int InstanceVBO = 0;
+    unsigned int NormalMatrixVBO = 0;
+    unsigned int VisibleVAO = 0; // 可见实例: 每帧重写的紧凑实例缓冲
+    unsigned int VisibleInstanceVBO = 0;
+    unsigned int VisibleNormalMatrixVBO = 0;
+    unsigned int ClusterVAO = 0; // 按簇排列的实例缓冲 (CreateClusters 之后才有)
+    unsigned int ClusterInstanceVBO = 0;
+    unsigned int ClusterNormalMatrixVBO = 0;
+    int MaxInstances = 0;
+    std::vector<Cluster> Clusters;
+    std::vector<uint32_t> ClusterInstances; // 按簇排列的实例下标
+    std::vector<glm::mat4> Transforms;
+    std::vector<glm::mat3> NormalMatrices;
+    double NormalMatrixMs = 0.0; // 批量计算法线矩阵的 CPU 耗时
+    LodStats Lod;
+
+    // mesh: 已上传的立方体网格 (属性 0..2 为位置/法线/纹理坐标)，需要在场景销毁前保持有效
+    // precomputeNormals: 在 CPU 上批量计算法线矩阵并作为实例属性上传
+    void Create(const Mesh& mesh, int maxInstances, bool precomputeNormals, unsigned int seed = 7)
+    {
+        cubeMesh = &mesh;
+        MaxInstances = std::max(maxInstances, 0);
+        generateTransforms(seed);
+
+        if (precomputeNormals)
+        {
+            auto start = std::chrono::steady_clock::now();
+            NormalMatrices.resize(Transforms.size());
+            ComputeNormalMatrices(Transforms.data(), NormalMatrices.data(), static_cast<int>(Transforms.size()));
+            NormalMatrixMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        glGenBuffers(1, &InstanceVBO);
+        glBindBuffer(GL_ARRAY_BUFFER, InstanceVBO);
+        glBufferData(GL_ARRAY_BUFFER, Transforms.size() * sizeof(glm::mat4), Transforms.data(), GL_STATIC_DRAW);
+        if (precomputeNormals)
+        {
+            glGenBuffers(1, &NormalMatrixVBO);
+            glBindBuffer(GL_ARRAY_BUFFER, NormalMatrixVBO);
+            glBufferData(GL_ARRAY_BUFFER, NormalMatrices.size() * sizeof(glm::mat3), NormalMatrices.data(), GL_STATIC_DRAW);
+        }
+        VAO = CreateInstanceVertexArray(mesh, InstanceVBO, NormalMatrixVBO);
+
+        // 可见实例缓冲在第一次 DrawVisible 时分配
+        glGenBuffers(1, &VisibleInstanceVBO);
+        if (precomputeNormals)
+            glGenBuffers(1, &VisibleNormalMatrixVBO);
+        VisibleVAO = CreateInstanceVertexArray(mesh, VisibleInstanceVBO, VisibleNormalMatrixVBO);
+    }
+
+    void Destroy()
+    {
+        glDeleteVertexArrays(1, &VAO);
+        glDeleteBuffers(1, &InstanceVBO);
+        glDeleteBuffers(1, &NormalMatrixVBO);
+        glDeleteVertexArrays(1, &VisibleVAO);
+        glDeleteBuffers(1, &VisibleInstanceVBO);
+        glDeleteBuffers(1, &VisibleNormalMatrixVBO);
+        glDeleteVertexArrays(1, &ClusterVAO);
+        glDeleteBuffers(1, &ClusterInstanceVBO);
+        glDeleteBuffers(1, &ClusterNormalMatrixVBO);
+        VAO = InstanceVBO = NormalMatrixVBO = 0;
+        VisibleVAO = VisibleInstanceVBO = VisibleNormalMatrixVBO = 0;
+        ClusterVAO = ClusterInstanceVBO = ClusterNormalMatrixVBO = 0;
+        MaxInstances = 0;
+        cubeMesh = nullptr;
+        Transforms.clear();
+        NormalMatrices.clear();
+        Clusters.clear();
+        ClusterInstances.clear();
+        for (LodBatch& batch : lodBatches)
+        {
+            glDeleteVertexArrays(1, &batch.VAO);
+            glDeleteBuffers(1, &batch.InstanceVBO);
+            glDeleteBuffers(1, &batch.NormalMatrixVBO);
+            glDeleteBuffers(1, &batch.FadeVBO);
+        }
+        lodBatches.clear();
+        lodMesh = nullptr;
+    }
+
+    // 画前 count 个实例 (调用方已经 use() 了 INSTANCED 变体的着色器并设置好 view/projection)
+    void Draw(int count) const
+    {
+        CPU_PROFILE_SCOPE("instanced_scene");
+        count = std::min(count, MaxInstances);
+        if (count <= 0)
+            return;
+        glBindVertexArray(VAO);
+        cubeMesh->DrawInstanced(count);
+        glBindVertexArray(0);
+    }
+
+    // 只画给定的实例 (剔除后的可见列表)，矩阵按列表顺序紧凑地上传后一次绘制
+    void DrawVisible(const std::vector<uint32_t>& instances)
+    {
+        CPU_PROFILE_SCOPE("instanced_scene_visible");
+        if (instances.empty())
+            return;
+        visibleTransforms.resize(instances.size());
+        for (size_t i = 0; i < instances.size(); ++i)
+            visibleTransforms[i] = Transforms[instances[i]];
+        // 整块重新分配 (orphan)，驱动不必等待上一帧对旧内容的读取
+        glBindBuffer(GL_ARRAY_BUFFER, VisibleInstanceVBO);
+        glBufferData(GL_ARRAY_BUFFER, visibleTransforms.size() * sizeof(glm::mat4), visibleTransforms.data(), GL_STREAM_DRAW);
+        if (VisibleNormalMatrixVBO != 0)
+        {
+            visibleNormalMatrices.resize(instances.size());
+            for (size_t i = 0; i < instances.size(); ++i)
+                visibleNormalMatrices[i] = NormalMatrices[instances[i]];
+            glBindBuffer(GL_ARRAY_BUFFER, VisibleNormalMatrixVBO);
+            glBufferData(GL_ARRAY_BUFFER, visibleNormalMatrices.size() * sizeof(glm::mat3), visibleNormalMatrices.data(), GL_STREAM_DRAW);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(VisibleVAO);
+        cubeMesh->DrawInstanced(static_cast<int>(instances.size()));
+        glBindVertexArray(0);
+    }
+
+    // 按实例位置所在的网格单元分簇，localBounds 为网格的局部包围盒
+    void CreateClusters(const Aabb& localBounds)
+    {
+        // 单元坐标打包成 64 位键，std::map 保证簇的顺序确定
+        std::map<int64_t, std::vector<uint32_t>> cells;
+        for (size_t i = 0; i < Transforms.size(); ++i)
+        {
+            glm::ivec3 cell = glm::ivec3(glm::floor(glm::vec3(Transforms[i][3]) / ClusterCellSize));
+            int64_t key = (static_cast<int64_t>(cell.x + 0x100000) << 42) | (static_cast<int64_t>(cell.y + 0x100000) << 21)
+                          | static_cast<int64_t>(cell.z + 0x100000);
+            cells[key].push_back(static_cast<uint32_t>(i));
+        }
+        Clusters.clear();
+        ClusterInstances.clear();
+        std::vector<glm::mat4> clusterTransforms;
+        std::vector<glm::mat3> clusterNormalMatrices;
+        for (const auto& cell : cells)
+        {
+            Cluster cluster;
+            cluster.First = static_cast<int>(ClusterInstances.size());
+            cluster.Count = static_cast<int>(cell.second.size());
+            for (uint32_t instance : cell.second)
+            {
+                cluster.Bounds.Expand(Aabb::Transform(localBounds, Transforms[instance]));
+                ClusterInstances.push_back(instance);
+                clusterTransforms.push_back(Transforms[instance]);
+                if (!NormalMatrices.empty())
+                    clusterNormalMatrices.push_back(NormalMatrices[instance]);
+            }
+            Clusters.push_back(cluster);
+        }
+        glGenBuffers(1, &ClusterInstanceVBO);
+        glBindBuffer(GL_ARRAY_BUFFER, ClusterInstanceVBO);
+        glBufferData(GL_ARRAY_BUFFER, clusterTransforms.size() * sizeof(glm::mat4), clusterTransforms.data(), GL_STATIC_DRAW);
+        if (!clusterNormalMatrices.empty())
+        {
+            glGenBuffers(1, &ClusterNormalMatrixVBO);
+            glBindBuffer(GL_ARRAY_BUFFER, ClusterNormalMatrixVBO);
+            glBufferData(GL_ARRAY_BUFFER, clusterNormalMatrices.size() * sizeof(glm::mat3), clusterNormalMatrices.data(), GL_STATIC_DRAW);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        ClusterVAO = CreateInstanceVertexArray(*cubeMesh, ClusterInstanceVBO, ClusterNormalMatrixVBO);
+    }
+
+    // 画第 cluster 簇中下标小于 count 的实例 (实例数渐增时)，返回画出的实例数
+    int DrawCluster(int cluster, int count)
+    {
+        const Cluster& c = Clusters[cluster];
+        auto first = ClusterInstances.begin() + c.First;
+        int drawn = static_cast<int>(std::lower_bound(first, first + c.Count, static_cast<uint32_t>(count)) - first);
+        if (drawn <= 0)
+            return 0;
+        glBindVertexArray(ClusterVAO);
+        SetInstanceAttributes(ClusterInstanceVBO, ClusterNormalMatrixVBO, c.First);
+        cubeMesh->DrawInstanced(drawn);
+        glBindVertexArray(0);
+        return drawn;
+    }
+
+    // 连续 LOD: lod 的第 0 级应当是 Create 时传入的网格 (实例矩阵和包围盒都沿用)，需要在场景销毁前保持有效
+    void CreateLod(const MeshLod& lod)
+    {
+        const int fadeLocation = 10; // 与 basic_lighting.vs 的 aInstanceFade 一致
+        lodMesh = &lod;
+        instanceScales.resize(Transforms.size());
+        for (size_t i = 0; i < Transforms.size(); ++i)
+            instanceScales[i] = glm::length(glm::vec3(Transforms[i][0])); // 均匀缩放
+        lodBatches.resize(lod.Levels.size());
+        for (size_t level = 0; level < lodBatches.size(); ++level)
+        {
+            LodBatch& batch = lodBatches[level];
+            glGenBuffers(1, &batch.InstanceVBO);
+            if (!NormalMatrices.empty())
+                glGenBuffers(1, &batch.NormalMatrixVBO);
+            glGenBuffers(1, &batch.FadeVBO);
+            batch.VAO = CreateInstanceVertexArray(lod.Levels[level], batch.InstanceVBO, batch.NormalMatrixVBO);
+            glBindVertexArray(batch.VAO);
+            glBindBuffer(GL_ARRAY_BUFFER, batch.FadeVBO);
+            glEnableVertexAttribArray(fadeLocation);
+            glVertexAttribPointer(fadeLocation, 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*)0);
+            glVertexAttribDivisor(fadeLocation, 1);
+            glBindVertexArray(0);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        Lod.LevelInstances.assign(lodBatches.size(), 0);
+    }
+
+    // 为 instances 中的每个实例按投影误差选择 LOD，按级别分组后每级一次实例化绘制 (淡化中的实例两级各画一次)
+    // pixelsPerUnit: 距离为 1 处单位长度在屏幕上的像素数；maxPixelError: 允许的投影误差 (像素)
+    void DrawLod(const Shader& shader, const std::vector<uint32_t>& instances, const glm::vec3& viewPos, float pixelsPerUnit,
+                 float maxPixelError)
+    {
+        CPU_PROFILE_SCOPE("instanced_scene_lod");
+        for (LodBatch& batch : lodBatches)
+        {
+            batch.Transforms.clear();
+            batch.NormalMatrices.clear();
+            batch.Fades.clear();
+        }
+        auto add = [&](int level, uint32_t instance, float fade) {
+            LodBatch& batch = lodBatches[level];
+            batch.Transforms.push_back(Transforms[instance]);
+            if (!NormalMatrices.empty())
+                batch.NormalMatrices.push_back(NormalMatrices[instance]);
+            batch.Fades.push_back(fade);
+            Lod.FrameTriangles += lodMesh->Levels[level].TriangleCount();
+            ++Lod.LevelInstances[level];
+        };
+        Lod.FrameInstances = static_cast<int>(instances.size());
+        Lod.FrameTriangles = 0;
+        double errorSum = 0.0;
+        for (uint32_t instance : instances)
+        {
+            // 到包围球表面的距离，摄像机在球内时按很近处理 (选第 0 级)
+            float scale = instanceScales[instance];
+            float distance = glm::length(glm::vec3(Transforms[instance][3]) - viewPos) - lodMesh->Radius * scale;
+            float objectPixels = pixelsPerUnit * scale / std::max(distance, 1e-3f);
+            float fade;
+            int level = lodMesh->SelectLevel(objectPixels, maxPixelError, fade);
+            if (fade > 0.0f)
+            {
+                add(level - 1, instance, fade);
+                add(level, instance, -fade);
+                ++Lod.FadingInstances;
+            }
+            else
+                add(level, instance, 1.0f);
+            float error = lodMesh->Errors[level] * objectPixels;
+            errorSum += error;
+            Lod.MaxError = std::max(Lod.MaxError, error);
+        }
+        Lod.FrameMeanError = instances.empty() ? 0.0f : static_cast<float>(errorSum / instances.size());
+        ++Lod.Frames;
+        Lod.Instances += static_cast<long long>(instances.size());
+        Lod.Triangles += Lod.FrameTriangles;
+        Lod.FullDetailTriangles += static_cast<long long>(instances.size()) * lodMesh->Levels[0].TriangleCount();
+        Lod.ErrorSum += errorSum;
+
+        for (size_t level = 0; level < lodBatches.size(); ++level)
+        {
+            LodBatch& batch = lodBatches[level];
+            if (batch.Transforms.empty())
+                continue;
+            // 与 DrawVisible 相同，整块重新分配 (orphan) 后上传
+            glBindBuffer(GL_ARRAY_BUFFER, batch.InstanceVBO);
+            glBufferData(GL_ARRAY_BUFFER, batch.Transforms.size() * sizeof(glm::mat4), batch.Transforms.data(), GL_STREAM_DRAW);
+            if (batch.NormalMatrixVBO != 0)
+            {
+                glBindBuffer(GL_ARRAY_BUFFER, batch.NormalMatrixVBO);
+                glBufferData(GL_ARRAY_BUFFER, batch.NormalMatrices.size() * sizeof(glm::mat3), batch.NormalMatrices.data(), GL_STREAM_DRAW);
+            }
+            glBindBuffer(GL_ARRAY_BUFFER, batch.FadeVBO);
+            glBufferData(GL_ARRAY_BUFFER, batch.Fades.size() * sizeof(float), batch.Fades.data(), GL_STREAM_DRAW);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            // 各级单独上传，位置量化的 scale/bias 各不相同
+            const Mesh& mesh = lodMesh->Levels[level];
+            mesh.SetPositionUniforms(shader);
+            glBindVertexArray(batch.VAO);
+            mesh.DrawInstanced(static_cast<int>(batch.Transforms.size()));
+        }
+        glBindVertexArray(0);
+    }
+
+    // 球壳格点上的 count 个随机朝向/大小的物体 (格点不够时少于 count 个)，结果只取决于 seed
+    // firstCell: 跳过由内向外的前 firstCell 个格点 (留给另一个场景，两者不相交)
+    static std::vector<glm::mat4> GenerateShellTransforms(int count, unsigned int seed, int firstCell = 0)
+    {
+        std::vector<glm::mat4> transforms;
+        if (count <= 0)
+            return transforms;
+        // 球壳体积 = 实例数 * 单个格点体积，由此求出外半径
+        double cellVolume = static_cast<double>(Spacing) * Spacing * Spacing;
+        double cellCount = static_cast<double>(count) + std::max(firstCell, 0);
+        double outer = std::cbrt(cellCount * cellVolume * 3.0 / (4.0 * 3.14159265) + std::pow(InnerRadius, 3.0));
+        int extent = static_cast<int>(std::ceil(outer / Spacing)) + 1;
+
+        std::vector<glm::vec3> cells;
+        for (int z = -extent; z <= extent; ++z)
+            for (int y = -extent; y <= extent; ++y)
+                for (int x = -extent; x <= extent; ++x)
+                {
+                    glm::vec3 p = glm::vec3(x, y, z) * Spacing;
+                    if (glm::length(p) >= InnerRadius)
+                        cells.push_back(p);
+                }
+        // 从内向外排序，距离相同的格点按坐标排序，保证结果确定
+        std::sort(cells.begin(), cells.end(), [](const glm::vec3& a, const glm::vec3& b) {
+            float da = glm::dot(a, a), db = glm::dot(b, b);
+            if (da != db)
+                return da < db;
+            if (a.x != b.x)
+                return a.x < b.x;
+            if (a.y != b.y)
+                return a.y < b.y;
+            return a.z < b.z;
+        });
+        firstCell = std::min(std::max(firstCell, 0), static_cast<int>(cells.size()));
+        count = std::min(count, static_cast<int>(cells.size()) - firstCell);
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        transforms.reserve(count);
+        for (int i = 0; i < count; ++i)
+        {
+            glm::vec3 jitter = (glm::vec3(unit(rng), unit(rng), unit(rng)) - 0.5f) * (Spacing * 0.3f);
+            glm::vec3 axis = glm::normalize(glm::vec3(unit(rng), unit(rng), unit(rng)) - 0.5f + 1e-3f);
+            glm::mat4 model = glm::translate(glm::mat4(1.0f), cells[firstCell + i] + jitter);
+            model = glm::rotate(model, unit(rng) * 6.2831853f, axis);
+            transforms.push_back(glm::scale(model, glm::vec3(0.3f + 0.3f * unit(rng))));
+        }
+        return transforms;
+    }
+
+    // 基准测试中逐帧增长的实例数: 第 frame 帧画 (frame + 1) / totalFrames 的实例
+    int RampCount(int frame, int totalFrames) const
+    {
+        if (totalFrames <= 0)
+            return MaxInstances;
+        return static_cast<int>(static_cast<long long>(MaxInstances) * (frame + 1) / totalFrames);
+    }
+
+private:
+    // 一个 LOD 级别本帧要画的实例
+    struct LodBatch
+    {
+        unsigned int VAO = 0;
+        unsigned int InstanceVBO = 0;
+        unsigned int NormalMatrixVBO = 0;
+        unsigned int FadeVBO = 0;
+        std::vector<glm::mat4> Transforms;
+        std::vector<glm::mat3> NormalMatrices;
+        std::vector<float> Fades;
+    };
+
+    const Mesh* cubeMesh = nullptr;
+    const MeshLod* lodMesh = nullptr;
+    std::vector<float> instanceScales;
+    std::vector<LodBatch> lodBatches;
+    std::vector<glm::mat4> visibleTransforms;
+    std::vector<glm::mat3> visibleNormalMatrices;
+
+    void generateTransforms(unsigned int seed)
+    {
+        Transforms = GenerateShellTransforms(MaxInstances, seed);
+        MaxInstances = static_cast<int>(Transforms.size());
+    }
+};
+
+#endif
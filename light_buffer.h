@@ -0,0 +1,94 @@
+#ifndef LIGHT_BUFFER_H
+#define LIGHT_BUFFER_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "lights.h"
+#include "shader_m.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 光照阶段的每帧光源数据 (std140 uniform block，GL 3.3 即可)
+// 代替逐个 setVec3 的 uniform 设置: 摄像机位置、光源数量和光源数组打包在一块连续内存里，
+// 每帧一次 glBufferSubData 上传，着色器中的布局见 lighting_pass.fs 的 LightBlock。
+class LightBuffer
+{
+public:
+    // uniform block 的绑定点
+    static const unsigned int BindingPoint = 0;
+    // GL 保证的最小 GL_MAX_UNIFORM_BLOCK_SIZE 为 16 KB: 16 字节头部 + 511 * 32 字节光源
+    static const int MaxLights = 511;
+
+    unsigned int UBO = 0;
+    // 最近一次上传的光源数量 (超过 MaxLights 的部分被截断)
+    int UploadedLights = 0;
+
+    // 着色器需要的预处理定义，数组长度与 MaxLights 一致
+    static std::string Defines()
+    {
+        return "#define MAX_BLOCK_LIGHTS " + std::to_string(MaxLights) + "\n";
+    }
+
+    void Create()
+    {
+        glGenBuffers(1, &UBO);
+        glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(Header) + MaxLights * sizeof(PointLight), nullptr, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, BindingPoint, UBO);
+        staging.reserve(sizeof(Header) + MaxLights * sizeof(PointLight));
+    }
+
+    void Destroy()
+    {
+        glDeleteBuffers(1, &UBO);
+        UBO = 0;
+    }
+
+    // 把着色器中的 LightBlock 连接到绑定点，只需在初始化时调用一次
+    static void BindBlock(const Shader& shader)
+    {
+        unsigned int blockIndex = glGetUniformBlockIndex(shader.ID, "LightBlock");
+        if (blockIndex == GL_INVALID_INDEX)
+        {
+            std::cout << "ERROR::LIGHT_BUFFER::BLOCK_NOT_FOUND" << std::endl;
+            return;
+        }
+        glUniformBlockBinding(shader.ID, blockIndex, BindingPoint);
+    }
+
+    // 每帧上传一次: 头部 + 前 count 个光源 (count 为 0 时只更新摄像机位置)
+    void Upload(const glm::vec3& viewPos, const std::vector<PointLight>& lights, size_t count)
+    {
+        UploadedLights = static_cast<int>(std::min(std::min(count, lights.size()), static_cast<size_t>(MaxLights)));
+        Header header = { viewPos, UploadedLights };
+        size_t lightBytes = UploadedLights * sizeof(PointLight);
+        staging.resize(sizeof(Header) + lightBytes);
+        std::memcpy(staging.data(), &header, sizeof(Header));
+        if (lightBytes > 0)
+            std::memcpy(staging.data() + sizeof(Header), lights.data(), lightBytes);
+
+        glBindBuffer(GL_UNIFORM_BUFFER, UBO);
+        glBufferSubData(GL_UNIFORM_BUFFER, 0, staging.size(), staging.data());
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    }
+
+private:
+    // 与 std140 布局一致: vec3 占 12 字节，紧跟的 int 落在偏移 12，光源数组从 16 开始
+    struct Header
+    {
+        glm::vec3 ViewPosition;
+        int LightCount;
+    };
+    static_assert(sizeof(Header) == 16, "LightBlock header must be 16 bytes");
+    static_assert(sizeof(PointLight) == 32, "PointLight must match the std140 struct layout");
+
+    std::vector<unsigned char> staging;
+};
+
+#endif
@@ -1,11 +1,15 @@
 #version 330 core
 layout (location = 0) in vec3 aPos;
 
+#ifndef VERTEX_POSITION
+#define VERTEX_POSITION(p) (p) // 位置未量化 (量化时由 vertex_format.h 生成的定义给出反量化)
+#endif
+
 uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
 
 void main()
 {
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
+    gl_Position = projection * view * model * vec4(VERTEX_POSITION(aPos), 1.0);
 }
\ No newline at end of file
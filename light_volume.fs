@@ -0,0 +1,69 @@
+// 文件名: light_volume.fs
+#version 330 core
+// 光源体积: 每个点光源画一个包围球，只有落在球内 (模板测试通过) 的像素才执行这个着色器，
+// 计算单个光源的贡献并以加法混合累加到输出上。环境光由 lighting_pass.fs (LIGHT_VOLUMES) 先行写入。
+// G-buffer 布局的预处理定义与 lighting_pass.fs 相同。
+out vec4 FragColor;
+
+// G-Buffer 纹理采样器 (gl_FragCoord 直接对应 G-buffer 左下角子矩形中的像素)
+#ifdef GBUFFER_RECONSTRUCT_POSITION
+uniform sampler2D gDepth;
+uniform mat4 invViewProjection;
+#else
+uniform sampler2D gPosition;
+#endif
+uniform sampler2D gNormal;
+uniform sampler2D gAlbedoSpec;
+
+uniform vec3 viewPos;
+uniform vec2 screenSize;
+uniform vec4 lightPositionRadius; // xyz: 世界空间位置, w: 影响半径
+uniform vec3 lightColor;
+
+#ifdef GBUFFER_OCT_NORMALS
+// 八面体编码法线的解码 (编码见 g_buffer.fs)
+vec3 decodeOctahedral(vec2 e)
+{
+    e = e * 2.0 - 1.0;
+    vec3 n = vec3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+#endif
+
+void main()
+{
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+#ifdef GBUFFER_RECONSTRUCT_POSITION
+    float depth = texelFetch(gDepth, pixel, 0).r;
+    vec4 world = invViewProjection * vec4(vec3(gl_FragCoord.xy / screenSize, depth) * 2.0 - 1.0, 1.0);
+    vec3 FragPos = world.xyz / world.w;
+#else
+    vec3 FragPos = texelFetch(gPosition, pixel, 0).rgb;
+#endif
+#ifdef GBUFFER_OCT_NORMALS
+    vec3 Normal = decodeOctahedral(texelFetch(gNormal, pixel, 0).rg);
+    bool hasGeometry = depth < 1.0;
+#else
+    vec3 Normal = texelFetch(gNormal, pixel, 0).rgb;
+    bool hasGeometry = length(Normal) > 0.1;
+#endif
+    vec3 toLight = lightPositionRadius.xyz - FragPos;
+    float distance = length(toLight);
+    if (!hasGeometry || distance >= lightPositionRadius.w)
+        discard;
+    vec4 AlbedoSpec = texelFetch(gAlbedoSpec, pixel, 0);
+
+    // 窗口衰减: 在半径处平滑降为 0 (与 tiled_lighting.cs 相同)
+    float falloff = 1.0 - pow(distance / lightPositionRadius.w, 4.0);
+    falloff *= falloff;
+
+    vec3 lightDir = toLight / distance;
+    vec3 viewDir = normalize(viewPos - FragPos);
+    float diff = max(dot(Normal, lightDir), 0.0);
+    vec3 halfwayDir = normalize(lightDir + viewDir);
+    float spec = pow(max(dot(Normal, halfwayDir), 0.0), 32.0);
+    FragColor = vec4((diff + AlbedoSpec.a * spec) * lightColor * falloff * AlbedoSpec.rgb, 1.0);
+}
@@ -0,0 +1,9 @@
+#version 330 core
+layout (location = 0) in vec3 aPos; // 单位球体的顶点 (或全屏三角形的 NDC 顶点)
+
+uniform mat4 mvp; // 光源体积: projection * view * model; 全屏三角形: 单位矩阵
+
+void main()
+{
+    gl_Position = mvp * vec4(aPos, 1.0);
+}
@@ -0,0 +1,6 @@
+#version 330 core
+// 光源体积的模板阶段只写模板缓冲 (颜色写入已关闭)，不需要任何输出
+
+void main()
+{
+}
@@ -0,0 +1,313 @@
+#ifndef LIGHT_VOLUMES_H
+#define LIGHT_VOLUMES_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "cpu_profiler.h"
+#include "gbuffer.h"
+#include "lights.h"
+#include "mesh.h"
+#include "occlusion_queries.h"
+#include "shader_m.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 光源体积 (light volume) 延迟光照
+// 每个点光源画一个包围球，只对球内的像素做光照计算，结果加法混合到输出帧缓冲:
+//   1. 先把光源的屏幕投影矩形设为剪裁矩形 (scissor)，后面的绘制都只涉及这个矩形
+//   2. 模板阶段: 关闭颜色写入，双面绘制球体，背面深度测试失败 +1、正面深度测试失败 -1，
+//      结果非 0 的像素就是几何体落在球内的像素
+//   3. 光照阶段: 剔除正面、关闭深度测试，只在模板非 0 处执行 light_volume.fs，
+//      同时把通过的像素的模板值清零，下一个光源不需要再清除模板缓冲
+// 相机在球内或球体越过远平面时，模板计数不可靠，改为在剪裁矩形内画全屏三角形，由着色器按半径丢弃像素。
+// 调用前输出帧缓冲需要已经有 G-buffer 的深度和环境光结果。
+// 开启遮挡查询时先对全部光源的包围盒发出查询 (此时深度已经完整，可以用同一帧的结果)，
+// 每个光源的模板和光照绘制包在条件渲染中，包围盒完全在几何体后面的光源不会产生任何着色。
+class LightVolumes
+{
+public:
+    static const int SphereSlices = 16;
+    static const int SphereStacks = 12;
+
+    Shader LightShader;
+    Shader StencilShader;
+    Mesh SphereMesh;
+    OcclusionQueries Queries;
+    bool UseQueries = false;
+    unsigned int SphereVAO = 0;
+    unsigned int FullScreenVAO = 0, FullScreenVBO = 0;
+
+    // 最近一帧的统计: 使用模板的光源数、退化为剪裁矩形全屏绘制的光源数、完全在屏幕外被跳过的光源数
+    int StencilledLights = 0;
+    int ScissorOnlyLights = 0;
+    int CulledLights = 0;
+
+    bool Create(const std::string& defines, const GBuffer& gBuffer, bool occlusionQueries = false)
+    {
+        // 同一帧的查询结果没有延迟，不需要滞后
+        UseQueries = occlusionQueries && Queries.Create(0);
+        LightShader = Shader("../light_volume.vs", "../light_volume.fs", defines);
+        StencilShader = Shader("../light_volume.vs", "../light_volume_stencil.fs");
+        if (LightShader.ID == 0 || StencilShader.ID == 0)
+            return false;
+        gBuffer.SetSamplerUniforms(LightShader);
+        // 每个光源都要设置的 uniform 提前取好位置，避免逐光源按名字查找
+        lightMvpLocation = glGetUniformLocation(LightShader.ID, "mvp");
+        lightPositionRadiusLocation = glGetUniformLocation(LightShader.ID, "lightPositionRadius");
+        lightColorLocation = glGetUniformLocation(LightShader.ID, "lightColor");
+        stencilMvpLocation = glGetUniformLocation(StencilShader.ID, "mvp");
+        createSphere();
+        createFullScreenTriangle();
+        return true;
+    }
+
+    void Destroy()
+    {
+        if (LightShader.ID != 0)
+            glDeleteProgram(LightShader.ID);
+        if (StencilShader.ID != 0)
+            glDeleteProgram(StencilShader.ID);
+        glDeleteVertexArrays(1, &SphereVAO);
+        SphereMesh.Destroy();
+        glDeleteVertexArrays(1, &FullScreenVAO);
+        glDeleteBuffers(1, &FullScreenVBO);
+        Queries.Destroy();
+        UseQueries = false;
+        LightShader.ID = StencilShader.ID = 0;
+        SphereVAO = FullScreenVAO = FullScreenVBO = 0;
+    }
+
+    void Render(const std::vector<PointLight>& lights, const GBuffer& gBuffer, const glm::mat4& view, const glm::mat4& projection,
+                const glm::vec3& viewPos, float nearPlane, float farPlane)
+    {
+        CPU_PROFILE_SCOPE("light_volumes");
+        StencilledLights = ScissorOnlyLights = CulledLights = 0;
+        glm::mat4 viewProjection = projection * view;
+        glm::ivec2 screen = gBuffer.Size;
+        if (UseQueries)
+            issueQueries(lights, view, projection, viewPos, nearPlane, screen);
+
+        LightShader.use();
+        gBuffer.BindTextures();
+        LightShader.setVec3("viewPos", viewPos);
+        LightShader.setVec2("screenSize", glm::vec2(screen));
+        LightShader.setMat4("invViewProjection", glm::inverse(viewProjection));
+
+        // 整帧只清除一次模板 (必须在开启裁剪测试之前，否则只清除上一帧最后一个光源的裁剪矩形)
+        glStencilMask(0xFF);
+        glClearStencil(0);
+        glClear(GL_STENCIL_BUFFER_BIT);
+        glDepthMask(GL_FALSE);
+        glEnable(GL_SCISSOR_TEST);
+        glEnable(GL_BLEND);
+        glBlendEquation(GL_FUNC_ADD);
+        glBlendFunc(GL_ONE, GL_ONE);
+
+        for (size_t i = 0; i < lights.size(); ++i)
+        {
+            const PointLight& light = lights[i];
+            glm::vec3 center = glm::vec3(light.PositionRadius);
+            float radius = light.PositionRadius.w;
+            glm::ivec4 rect;
+            if (!scissorRect(view, projection, center, radius, nearPlane, screen, rect))
+            {
+                ++CulledLights;
+                continue;
+            }
+            glScissor(rect.x, rect.y, rect.z, rect.w);
+
+            // 球体网格的顶点在 sphereScale * radius 处，面到球心的距离不小于 radius
+            float meshRadius = radius * sphereScale;
+            float viewDepth = -(view * glm::vec4(center, 1.0f)).z;
+            bool cameraInside = glm::length(viewPos - center) < meshRadius + nearPlane;
+            bool crossesFar = viewDepth + meshRadius > farPlane;
+            glm::mat4 mvp = viewProjection * glm::scale(glm::translate(glm::mat4(1.0f), center), glm::vec3(meshRadius));
+
+            if (UseQueries)
+                Queries.BeginConditional(static_cast<int>(i));
+            if (cameraInside || crossesFar)
+            {
+                ++ScissorOnlyLights;
+                glDisable(GL_STENCIL_TEST);
+                glDisable(GL_DEPTH_TEST);
+                glDisable(GL_CULL_FACE);
+                LightShader.use();
+                glm::mat4 identity(1.0f);
+                setLightUniforms(light, identity);
+                glBindVertexArray(FullScreenVAO);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+                if (UseQueries)
+                    Queries.EndConditional(static_cast<int>(i));
+                continue;
+            }
+
+            ++StencilledLights;
+            // 模板阶段
+            StencilShader.use();
+            glUniformMatrix4fv(stencilMvpLocation, 1, GL_FALSE, &mvp[0][0]);
+            glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+            glEnable(GL_STENCIL_TEST);
+            glStencilFunc(GL_ALWAYS, 0, 0xFF);
+            glStencilOpSeparate(GL_BACK, GL_KEEP, GL_INCR_WRAP, GL_KEEP);
+            glStencilOpSeparate(GL_FRONT, GL_KEEP, GL_DECR_WRAP, GL_KEEP);
+            glEnable(GL_DEPTH_TEST);
+            glDisable(GL_CULL_FACE);
+            glBindVertexArray(SphereVAO);
+            SphereMesh.Draw();
+
+            // 光照阶段
+            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+            glStencilFunc(GL_NOTEQUAL, 0, 0xFF);
+            glStencilOp(GL_KEEP, GL_KEEP, GL_ZERO); // 背面覆盖了球体的整个投影，所有非 0 的像素都会被清零
+            glDisable(GL_DEPTH_TEST);
+            glEnable(GL_CULL_FACE);
+            glCullFace(GL_FRONT); // 只画背面，相机贴近球体时正面被近平面裁掉也不影响
+            LightShader.use();
+            setLightUniforms(light, mvp);
+            SphereMesh.Draw();
+            if (UseQueries)
+                Queries.EndConditional(static_cast<int>(i));
+        }
+        glBindVertexArray(0);
+
+        // 恢复默认状态
+        glCullFace(GL_BACK);
+        glDisable(GL_CULL_FACE);
+        glDisable(GL_STENCIL_TEST);
+        glDisable(GL_BLEND);
+        glDisable(GL_SCISSOR_TEST);
+        glStencilOp(GL_KEEP, GL_KEEP, GL_KEEP);
+        glEnable(GL_DEPTH_TEST);
+        glDepthMask(GL_TRUE);
+    }
+
+private:
+    GLint lightMvpLocation = -1;
+    GLint lightPositionRadiusLocation = -1;
+    GLint lightColorLocation = -1;
+    GLint stencilMvpLocation = -1;
+    // 低模球体内切于单位球时会漏掉边缘像素，把顶点向外推，使每个面到球心的距离都不小于 1
+    float sphereScale = 1.0f / (std::cos(3.14159265f / SphereSlices) * std::cos(3.14159265f / SphereStacks));
+
+    // 光源包围球的外接立方体 (与球体网格同样放大) 作为代理；屏幕外的光源不发查询
+    void issueQueries(const std::vector<PointLight>& lights, const glm::mat4& view, const glm::mat4& projection,
+                      const glm::vec3& viewPos, float nearPlane, glm::ivec2 screen)
+    {
+        Queries.BeginFrame(static_cast<int>(lights.size()));
+        Queries.BeginProxies(projection * view, viewPos, nearPlane);
+        for (size_t i = 0; i < lights.size(); ++i)
+        {
+            glm::vec3 center = glm::vec3(lights[i].PositionRadius);
+            float meshRadius = lights[i].PositionRadius.w * sphereScale;
+            glm::ivec4 rect;
+            if (scissorRect(view, projection, center, lights[i].PositionRadius.w, nearPlane, screen, rect))
+                Queries.Proxy(static_cast<int>(i), { center - meshRadius, center + meshRadius });
+            else
+                Queries.Skip(static_cast<int>(i));
+        }
+        Queries.EndProxies();
+    }
+
+    void setLightUniforms(const PointLight& light, const glm::mat4& mvp)
+    {
+        glUniformMatrix4fv(lightMvpLocation, 1, GL_FALSE, &mvp[0][0]);
+        glUniform4fv(lightPositionRadiusLocation, 1, &light.PositionRadius[0]);
+        glUniform3fv(lightColorLocation, 1, &light.Color[0]);
+    }
+
+    // 光源包围球在屏幕上的投影矩形 (像素)，完全在屏幕外时返回 false
+    // 取视图空间 AABB 的 8 个角点投影，保守但足够简单；有角点在近平面之后时直接用整个屏幕
+    static bool scissorRect(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& center, float radius,
+                            float nearPlane, glm::ivec2 screen, glm::ivec4& rect)
+    {
+        glm::vec3 viewCenter = glm::vec3(view * glm::vec4(center, 1.0f));
+        if (-viewCenter.z + radius < nearPlane)
+            return false; // 整个球在相机后方
+        glm::vec2 ndcMin(1.0f), ndcMax(-1.0f);
+        if (-viewCenter.z - radius < nearPlane)
+        {
+            ndcMin = glm::vec2(-1.0f);
+            ndcMax = glm::vec2(1.0f);
+        }
+        else
+        {
+            for (int corner = 0; corner < 8; ++corner)
+            {
+                glm::vec3 offset((corner & 1) ? radius : -radius, (corner & 2) ? radius : -radius, (corner & 4) ? radius : -radius);
+                glm::vec4 clip = projection * glm::vec4(viewCenter + offset, 1.0f);
+                glm::vec2 ndc = glm::vec2(clip.x, clip.y) / clip.w;
+                ndcMin = glm::min(ndcMin, ndc);
+                ndcMax = glm::max(ndcMax, ndc);
+            }
+            ndcMin = glm::max(ndcMin, glm::vec2(-1.0f));
+            ndcMax = glm::min(ndcMax, glm::vec2(1.0f));
+            if (ndcMin.x >= ndcMax.x || ndcMin.y >= ndcMax.y)
+                return false;
+        }
+        glm::vec2 size(screen);
+        int x0 = static_cast<int>(std::floor((ndcMin.x * 0.5f + 0.5f) * size.x));
+        int y0 = static_cast<int>(std::floor((ndcMin.y * 0.5f + 0.5f) * size.y));
+        int x1 = static_cast<int>(std::ceil((ndcMax.x * 0.5f + 0.5f) * size.x));
+        int y1 = static_cast<int>(std::ceil((ndcMax.y * 0.5f + 0.5f) * size.y));
+        rect = glm::ivec4(x0, y0, x1 - x0, y1 - y0);
+        return rect.z > 0 && rect.w > 0;
+    }
+
+    // 经纬度球体 (逆时针为外侧正面)
+    void createSphere()
+    {
+        std::vector<float> vertices;
+        std::vector<uint32_t> indices;
+        for (int stack = 0; stack <= SphereStacks; ++stack)
+        {
+            float phi = 3.14159265f * stack / SphereStacks;
+            for (int slice = 0; slice <= SphereSlices; ++slice)
+            {
+                float theta = 2.0f * 3.14159265f * slice / SphereSlices;
+                vertices.push_back(std::sin(phi) * std::cos(theta));
+                vertices.push_back(std::cos(phi));
+                vertices.push_back(std::sin(phi) * std::sin(theta));
+            }
+        }
+        for (int stack = 0; stack < SphereStacks; ++stack)
+        {
+            for (int slice = 0; slice < SphereSlices; ++slice)
+            {
+                unsigned int a = stack * (SphereSlices + 1) + slice;
+                unsigned int b = a + SphereSlices + 1;
+                indices.insert(indices.end(), { a, a + 1, b, a + 1, b + 1, b });
+            }
+        }
+        // 两极的顶点焊接后，极点处的退化三角形在构建时被去掉
+        SphereMesh.Build(vertices.data(), static_cast<int>(vertices.size() / 3), 3, indices);
+        SphereMesh.Upload({ { "aPos", 0, 0, 3, VERTEX_FLOAT32 } });
+        SphereMesh.PrintSummary("light volume sphere");
+
+        glGenVertexArrays(1, &SphereVAO);
+        glBindVertexArray(SphereVAO);
+        SphereMesh.SetupAttributes();
+        glBindVertexArray(0);
+    }
+
+    // 覆盖整个屏幕的三角形 (NDC 坐标，mvp 传单位矩阵)
+    void createFullScreenTriangle()
+    {
+        float vertices[] = { -1.0f, -1.0f, 0.0f,  3.0f, -1.0f, 0.0f,  -1.0f, 3.0f, 0.0f };
+        glGenVertexArrays(1, &FullScreenVAO);
+        glGenBuffers(1, &FullScreenVBO);
+        glBindVertexArray(FullScreenVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, FullScreenVBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glBindVertexArray(0);
+    }
+};
+
+#endif
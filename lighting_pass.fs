@@ -5,48 +5,259 @@ out vec4 FragColor; // 输出最终的颜色到屏幕
 in vec2 TexCoords; // 从顶点着色器接收的纹理坐标 (屏幕空间)
 
 // G-Buffer 纹理采样器
+#ifdef GBUFFER_RECONSTRUCT_POSITION
+uniform sampler2D gDepth;       // 深度纹理 (用于重建世界坐标)
+uniform mat4 invViewProjection; // (projection * view) 的逆矩阵
+#else
 uniform sampler2D gPosition;    // 位置纹理
+#endif
 uniform sampler2D gNormal;      // 法线纹理
 uniform sampler2D gAlbedoSpec;  // 反照率(rgb) + 镜面强度(a) 纹理
+uniform vec2 gBufferUVScale;    // 窗口尺寸 / G-buffer 分配尺寸 (G-buffer 可能大于窗口)
 
-// 光照所需的 Uniform 变量
-uniform vec3 lightPos;   // 光源位置 (世界空间)
-uniform vec3 viewPos;    // 观察者/相机位置 (世界空间)
-uniform vec3 lightColor; // 光源颜色
+// 每帧光源数据，由 light_buffer.h 一次上传 (std140，布局与 LightBuffer::Header + PointLight 一致)
+struct PointLight
+{
+    vec4 positionRadius; // xyz: 世界空间位置, w: 影响半径
+    vec4 color;          // rgb: 颜色
+};
+layout(std140) uniform LightBlock
+{
+    vec3 viewPos;        // 观察者/相机位置 (世界空间)
+    int lightCount;      // lights 中有效的光源数量
+    PointLight lights[MAX_BLOCK_LIGHTS];
+};
+
+#ifdef CLUSTERED_LIGHTING
+// CPU 分簇光源分配的结果 (见 clustered_lighting.h)
+uniform samplerBuffer lightData;     // 每个光源 2 个 texel: 位置+半径, 颜色
+uniform usamplerBuffer lightGrid;    // 每个簇: (索引列表起点, 光源数量)
+uniform usamplerBuffer lightIndices; // 各簇的光源索引首尾相接
+uniform mat4 view;
+uniform vec2 screenSize;
+uniform ivec3 clusterDims;
+uniform float clusterNear;           // 第一个深度切片的起点 (近平面)
+uniform float clusterLogDepthRange;  // log(far / near)
+#endif
+
+#ifdef CASCADED_SHADOWS
+// 方向光级联阴影 (见 cascaded_shadows.h)
+uniform sampler2DArrayShadow cascadeShadowMap;
+uniform mat4 cascadeMatrices[CASCADE_COUNT];    // 世界空间 -> [0,1] 的阴影贴图坐标
+uniform float cascadeNormalOffsets[CASCADE_COUNT]; // 沿法线的采样偏移 (世界空间，约 1.5 个 texel)
+uniform vec3 sunDirection; // 光线的传播方向 (归一化)
+uniform vec3 sunColor;
+
+// 返回 [0,1] 的可见度。级联的投影可能是几帧前拟合的，按覆盖关系而不是切分深度选择:
+// 从最精细的级联开始，取第一个包含该点的
+float cascadeVisibility(vec3 worldPos, vec3 normal)
+{
+    vec2 texel = 1.0 / vec2(textureSize(cascadeShadowMap, 0).xy);
+    for (int i = 0; i < CASCADE_COUNT; ++i)
+    {
+        vec3 coord = (cascadeMatrices[i] * vec4(worldPos + normal * cascadeNormalOffsets[i], 1.0)).xyz;
+        if (any(lessThan(coord.xy, texel * 2.0)) || any(greaterThan(coord.xy, 1.0 - texel * 2.0)) || coord.z > 1.0)
+            continue;
+        // 3x3 PCF，每次采样由硬件再做 2x2 双线性比较
+        float visibility = 0.0;
+        for (int y = -1; y <= 1; ++y)
+            for (int x = -1; x <= 1; ++x)
+                visibility += texture(cascadeShadowMap, vec4(coord.xy + vec2(x, y) * texel, float(i), coord.z));
+        return visibility / 9.0;
+    }
+    return 1.0; // 超出阴影距离
+}
+#endif
+
+#ifdef POINT_SHADOWS
+// 点光源全向阴影 (见 point_shadows.h)。前 pointShadowCount 个光源的 6 个面各占阴影图集中的一个图块
+uniform sampler2DShadow pointShadowAtlas;
+uniform samplerBuffer pointShadowTiles; // 每个光源 6 个 texel: (x, y, 边长, 0)，单位为 texel；边长为 0 表示本帧没有阴影
+uniform int pointShadowCount;
+uniform float pointShadowAtlasSize;
+
+// 按立方体贴图的约定选择主轴所在的面，返回面内 [0,1] 坐标
+vec2 cubeFaceUV(vec3 d, out int face)
+{
+    vec3 a = abs(d);
+    vec2 st;
+    float ma;
+    if (a.x >= a.y && a.x >= a.z)
+    {
+        face = d.x > 0.0 ? 0 : 1;
+        ma = a.x;
+        st = vec2(d.x > 0.0 ? -d.z : d.z, -d.y);
+    }
+    else if (a.y >= a.z)
+    {
+        face = d.y > 0.0 ? 2 : 3;
+        ma = a.y;
+        st = vec2(d.x, d.y > 0.0 ? d.z : -d.z);
+    }
+    else
+    {
+        face = d.z > 0.0 ? 4 : 5;
+        ma = a.z;
+        st = vec2(d.z > 0.0 ? d.x : -d.x, -d.y);
+    }
+    return st / ma * 0.5 + 0.5;
+}
+
+// 图集中存的是到光源的线性距离 / 半径，直接与片段的距离比较
+float pointShadowVisibility(int lightIndex, vec3 worldPos, vec3 normal, vec4 positionRadius)
+{
+    int face;
+    vec3 fromLight = worldPos - positionRadius.xyz;
+    cubeFaceUV(fromLight, face);
+    float tileSize = texelFetch(pointShadowTiles, lightIndex * 6 + face).z;
+    if (tileSize == 0.0)
+        return 1.0;
+    // 沿法线偏移约 1.5 个 texel 的世界空间尺寸 (90 度视角的面，一个 texel 约为 2 / 边长 弧度)，偏移后重新选择面
+    fromLight += normal * (1.5 * 2.0 / tileSize * length(fromLight));
+    vec2 uv = cubeFaceUV(fromLight, face);
+    vec4 tile = texelFetch(pointShadowTiles, lightIndex * 6 + face);
+    // 限制在图块内半个 texel，双线性比较不会采到相邻图块
+    vec2 texel = tile.xy + clamp(uv * tile.z, vec2(0.5), vec2(tile.z - 0.5));
+    float reference = (length(fromLight) - 0.01) / positionRadius.w;
+    return texture(pointShadowAtlas, vec3(texel / pointShadowAtlasSize, reference));
+}
+#endif
+
+#ifdef GBUFFER_OCT_NORMALS
+// 八面体编码法线的解码 (编码见 g_buffer.fs)
+vec3 decodeOctahedral(vec2 e)
+{
+    e = e * 2.0 - 1.0;
+    vec3 n = vec3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+#endif
+
+#ifdef GBUFFER_RECONSTRUCT_POSITION
+// 由深度值和屏幕坐标重建世界空间位置:
+// 屏幕坐标与深度 [0,1] 映射回 NDC [-1,1]，再乘以逆视图投影矩阵并做透视除法
+// (screenUV 是未缩放的屏幕坐标，uv 是 G-buffer 中的采样坐标)
+vec3 reconstructWorldPosition(vec2 screenUV, vec2 uv)
+{
+    float depth = texture(gDepth, uv).r;
+    vec4 ndc = vec4(vec3(screenUV, depth) * 2.0 - 1.0, 1.0);
+    vec4 world = invViewProjection * ndc;
+    return world.xyz / world.w;
+}
+#endif
 
 void main()
 {
     // 1. 从 G-Buffer 恢复几何/颜色信息
     // 使用传入的屏幕空间纹理坐标 TexCoords 对 G-Buffer 纹理进行采样
-    vec3 FragPos = texture(gPosition, TexCoords).rgb;     // 获取世界空间位置
-    vec3 Normal = texture(gNormal, TexCoords).rgb;        // 获取世界空间法线
-    vec3 Albedo = texture(gAlbedoSpec, TexCoords).rgb;    // 获取反照率颜色
-    float SpecularStrength = texture(gAlbedoSpec, TexCoords).a; // 获取镜面强度
+    vec2 uv = TexCoords * gBufferUVScale;
+#ifdef GBUFFER_RECONSTRUCT_POSITION
+    vec3 FragPos = reconstructWorldPosition(TexCoords, uv); // 由深度重建世界空间位置
+#else
+    vec3 FragPos = texture(gPosition, uv).rgb;     // 获取世界空间位置
+#endif
+#ifdef GBUFFER_OCT_NORMALS
+    vec3 Normal = decodeOctahedral(texture(gNormal, uv).rg); // 解码世界空间法线
+    // 编码后的法线无法用长度区分背景，改用深度: 背景像素保持清除值 1.0
+    bool hasGeometry = texture(gDepth, uv).r < 1.0;
+#else
+    vec3 Normal = texture(gNormal, uv).rgb;        // 获取世界空间法线
+    bool hasGeometry = length(Normal) > 0.1;              // 背景像素的法线为 0
+#endif
+    vec3 Albedo = texture(gAlbedoSpec, uv).rgb;    // 获取反照率颜色
+    float SpecularStrength = texture(gAlbedoSpec, uv).a; // 获取镜面强度
 
     // 2. 执行光照计算 (这里使用和之前前向渲染类似的 Blinn-Phong 模型)
     vec3 lighting = vec3(0.0); // 初始化光照结果
 
     // 检查法线是否有效（可选，避免在背景像素上计算光照）
     // 如果法线长度接近 0，则认为这是背景，直接输出黑色并返回
-    if(length(Normal) > 0.1) // 避免对背景像素进行光照计算 (法线通常为 0)
+    if(hasGeometry) // 避免对背景像素进行光照计算
     {
-         // 环境光 (Ambient)
-        float ambientStrength = 0.1;
-        vec3 ambient = ambientStrength * lightColor;
+#if defined(LIGHT_VOLUMES)
+        // 只写环境光，各光源的贡献由 light_volume.fs 按光源体积叠加
+        lighting = vec3(0.1) * Albedo;
+#elif defined(CLUSTERED_LIGHTING)
+        // 由屏幕位置和视图空间深度找到所在的簇，只遍历分配到该簇的光源
+        float viewDepth = -(view * vec4(FragPos, 1.0)).z;
+        int slice = int(log(max(viewDepth, clusterNear) / clusterNear) / clusterLogDepthRange * float(clusterDims.z));
+        ivec3 cluster = clamp(ivec3(ivec2(gl_FragCoord.xy / screenSize * vec2(clusterDims.xy)), slice), ivec3(0), clusterDims - 1);
+        uvec2 range = texelFetch(lightGrid, (cluster.z * clusterDims.y + cluster.y) * clusterDims.x + cluster.x).rg;
 
-        // 漫反射光 (Diffuse)
-        vec3 lightDir = normalize(lightPos - FragPos); // 光线方向
-        float diff = max(dot(Normal, lightDir), 0.0); // 漫反射强度因子
-        vec3 diffuse = diff * lightColor;
+        vec3 viewDir = normalize(viewPos - FragPos);
+        vec3 accumulated = vec3(0.1); // 环境光只计算一次
+        for (uint i = 0u; i < range.y; ++i)
+        {
+            int lightIndex = int(texelFetch(lightIndices, int(range.x + i)).r);
+            vec4 positionRadius = texelFetch(lightData, lightIndex * 2);
+            vec3 color = texelFetch(lightData, lightIndex * 2 + 1).rgb;
+            vec3 toLight = positionRadius.xyz - FragPos;
+            float distance = length(toLight);
+            if (distance >= positionRadius.w)
+                continue;
+            // 窗口衰减: 在半径处平滑降为 0 (与 tiled_lighting.cs 相同)
+            float falloff = 1.0 - pow(distance / positionRadius.w, 4.0);
+            falloff *= falloff;
+#ifdef POINT_SHADOWS
+            if (lightIndex < pointShadowCount)
+                falloff *= pointShadowVisibility(lightIndex, FragPos, Normal, positionRadius);
+#endif
 
-        // 镜面反射光 (Specular - Blinn-Phong)
+            vec3 lightDir = toLight / distance;
+            float diff = max(dot(Normal, lightDir), 0.0);
+            vec3 halfwayDir = normalize(lightDir + viewDir);
+            float spec = pow(max(dot(Normal, halfwayDir), 0.0), 32.0);
+            accumulated += (diff + SpecularStrength * spec) * color * falloff;
+        }
+        lighting = accumulated * Albedo;
+#else
+        // 遍历 LightBlock 中的全部光源
+        // 环境光 (Ambient) 只计算一次
+        float ambientStrength = 0.1;
+        vec3 accumulated = vec3(ambientStrength);
         vec3 viewDir = normalize(viewPos - FragPos);      // 观察方向
-        vec3 halfwayDir = normalize(lightDir + viewDir); // 半程向量
-        float spec = pow(max(dot(Normal, halfwayDir), 0.0), 32.0); // 镜面反射强度因子 (32 是高光指数)
-        vec3 specular = SpecularStrength * spec * lightColor; // 乘以从 G-Buffer 获取的镜面强度
+        for (int i = 0; i < lightCount; ++i)
+        {
+            vec3 toLight = lights[i].positionRadius.xyz - FragPos;
+            float distance = length(toLight);
+            if (distance >= lights[i].positionRadius.w)
+                continue;
+            // 窗口衰减: 在半径处平滑降为 0 (与分簇/分块路径相同)
+            float falloff = 1.0 - pow(distance / lights[i].positionRadius.w, 4.0);
+            falloff *= falloff;
+#ifdef POINT_SHADOWS
+            if (i < pointShadowCount)
+                falloff *= pointShadowVisibility(i, FragPos, Normal, lights[i].positionRadius);
+#endif
+
+            // 漫反射光 (Diffuse)
+            vec3 lightDir = toLight / distance; // 光线方向
+            float diff = max(dot(Normal, lightDir), 0.0); // 漫反射强度因子
+
+            // 镜面反射光 (Specular - Blinn-Phong)
+            vec3 halfwayDir = normalize(lightDir + viewDir); // 半程向量
+            float spec = pow(max(dot(Normal, halfwayDir), 0.0), 32.0); // 镜面反射强度因子 (32 是高光指数)
+            // 镜面强度来自 G-Buffer
+            accumulated += (diff + SpecularStrength * spec) * lights[i].color.rgb * falloff;
+        }
 
         // 最终光照 = (环境光 + 漫反射光 + 镜面反射光) * 物体反照率颜色
-        lighting = (ambient + diffuse + specular) * Albedo;
+        lighting = accumulated * Albedo;
+#endif
+#ifdef CASCADED_SHADOWS
+        // 方向光 (太阳) 叠加在上面的结果上，只有这一项受阴影影响
+        {
+            vec3 sunDir = -sunDirection;
+            float sunDiff = max(dot(Normal, sunDir), 0.0);
+            vec3 sunHalfway = normalize(sunDir + normalize(viewPos - FragPos));
+            float sunSpec = pow(max(dot(Normal, sunHalfway), 0.0), 32.0);
+            float visibility = sunDiff > 0.0 ? cascadeVisibility(FragPos, Normal) : 0.0;
+            lighting += (sunDiff + SpecularStrength * sunSpec) * sunColor * visibility * Albedo;
+        }
+#endif
     }
     else
     {
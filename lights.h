@@ -0,0 +1,79 @@
+#ifndef LIGHTS_H
+#define LIGHTS_H
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// 点光源，布局与着色器中的 std430 结构一致 (每个 32 字节)
+struct PointLight
+{
+    glm::vec4 PositionRadius; // xyz: 世界空间位置, w: 影响半径 (半径外贡献为 0)
+    glm::vec4 Color;          // rgb: 颜色 (已乘强度), w: 未使用
+};
+
+// 场景中的动态点光源
+// Lights[0] 是原来的主光源 (固定位置，半径足够大，效果与之前的单光源一致)，
+// 其余光源绕 Y 轴做圆周运动，参数由固定种子生成，每次运行结果相同。
+class LightField
+{
+public:
+    // 主光源的影响半径: 足够大，窗口衰减在场景范围内约等于 1
+    constexpr static float PrimaryRadius = 1000.0f;
+
+    std::vector<PointLight> Lights;
+
+    void Create(const glm::vec3& primaryPosition, const glm::vec3& primaryColor, int extraCount, unsigned int seed = 1337)
+    {
+        Lights.clear();
+        orbits.clear();
+        Lights.push_back({ glm::vec4(primaryPosition, PrimaryRadius), glm::vec4(primaryColor, 0.0f) });
+        orbits.push_back({ 0.0f, 0.0f, primaryPosition.y, 0.0f });
+
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+        // 光源越多单个越暗，避免叠加后整体过曝
+        float intensity = std::min(1.0f, 32.0f / std::max(extraCount, 1));
+        for (int i = 0; i < extraCount; ++i)
+        {
+            Orbit orbit;
+            orbit.Distance = 0.8f + 2.2f * unit(rng);
+            orbit.Angle = 6.2831853f * unit(rng);
+            orbit.Height = -1.5f + 3.0f * unit(rng);
+            orbit.Speed = (unit(rng) - 0.5f) * 1.5f;
+            float radius = 0.5f + unit(rng);
+            glm::vec3 color = glm::normalize(glm::vec3(unit(rng), unit(rng), unit(rng)) + 0.05f) * intensity;
+            orbits.push_back(orbit);
+            Lights.push_back({ glm::vec4(0.0f, 0.0f, 0.0f, radius), glm::vec4(color, 0.0f) });
+        }
+        Update(0.0f);
+    }
+
+    // 按动画时间 (秒) 更新光源位置，主光源不动
+    void Update(float time)
+    {
+        for (size_t i = 1; i < Lights.size(); ++i)
+        {
+            const Orbit& orbit = orbits[i];
+            float angle = orbit.Angle + orbit.Speed * time;
+            Lights[i].PositionRadius.x = std::cos(angle) * orbit.Distance;
+            Lights[i].PositionRadius.y = orbit.Height;
+            Lights[i].PositionRadius.z = std::sin(angle) * orbit.Distance;
+        }
+    }
+
+private:
+    struct Orbit
+    {
+        float Distance; // 到 Y 轴的距离
+        float Angle;    // 初始角度 (弧度)
+        float Height;
+        float Speed;    // 角速度 (弧度/秒)
+    };
+    std::vector<Orbit> orbits;
+};
+
+#endif
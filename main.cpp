@@ -6,15 +6,45 @@
 #include <glm/gtc/type_ptr.hpp>
 #include "shader_m.h"
 #include "camera.h"
+#include "render_options.h"
+#include "benchmark.h"
+#include "headless_context.h"
+#include "gpu_profiler.h"
+#include "cpu_profiler.h"
+#include "input_replay.h"
+#include "gbuffer.h"
+#include "lights.h"
+#include "tiled_lighting.h"
+#include "clustered_lighting.h"
+#include "light_volumes.h"
+#include "light_buffer.h"
+#include "cascaded_shadows.h"
+#include "point_shadows.h"
+#include "instanced_scene.h"
+#include "normal_matrix.h"
+#include "mesh.h"
+#include "mesh_lod.h"
+#include "vertex_format.h"
+#include "scene_bvh.h"
+#include "gpu_culling.h"
+#include "hiz_pyramid.h"
+#include "software_occlusion.h"
+#include "occlusion_queries.h"
+#include "render_queue.h"
+#include "material_scene.h"
+#include "thread_pool.h"
 #define STB_IMAGE_IMPLEMENTATION
 #include "stb_image.h"
 #include <iostream>
 #include <vector>
+#include <chrono>
+#include <numeric>
 
 // 函数声明
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);
 void mouse_callback(GLFWwindow* window, double xpos, double ypos);
 void scroll_callback(GLFWwindow* window, double xoffset, double yoffset);
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
 void processInput(GLFWwindow *window);
 unsigned int loadTexture(const char *path);
 void renderQuad();
@@ -22,12 +52,16 @@ void renderQuad();
 // 设置
 unsigned int SCR_WIDTH = 800;
 unsigned int SCR_HEIGHT = 600;
+const float NEAR_PLANE = 0.1f;
+const float FAR_PLANE = 100.0f;
 
 // 摄像机
 Camera camera(glm::vec3(0.0f, 0.0f, 5.0f)); // 将相机稍微向后移动
 float lastX = SCR_WIDTH / 2.0f;
 float lastY = SCR_HEIGHT / 2.0f;
 bool firstMouse = true;
+// 本帧累计的输入 (回调和 processInput 写入，每帧应用到摄像机后清空)
+FrameInput frameInput;
 
 // 时间
 float deltaTime = 0.0f;
@@ -37,59 +71,149 @@ float lastFrame = 0.0f;
 glm::vec3 lightPos(1.2f, 1.0f, 2.0f);
 
 // G-buffer 全局变量 (为了 framebuffer_size_callback 访问)
-unsigned int gBuffer;
-unsigned int gPosition, gNormal, gAlbedoSpec;
-unsigned int rboDepth;
+GBuffer gBuffer;
+GBufferLayout gBufferLayout = GBUFFER_CLASSIC;
+// 热键请求 (在 key_callback 中置位，渲染循环中处理)
+bool gpuStatsRequested = false; // F2: 打印并导出各 pass 的 GPU 耗时
+bool cpuTraceRequested = false; // F3: 导出 CPU trace
+
+// 最终输出的帧缓冲: 窗口模式下为默认帧缓冲 0，离屏模式下为 OffscreenTarget
+unsigned int outputFBO = 0;
 // 屏幕四边形 VAO/VBO
 unsigned int quadVAO = 0;
 unsigned int quadVBO;
 
-int main()
+int main(int argc, char* argv[])
 {
-    // glfw: 初始化和配置
-    glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-    // glfwWindowHint(GLFW_RESIZABLE, GL_FALSE); // 允许调整窗口大小以处理 gbuffer
-
-    // glfw 窗口创建
-    GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Deferred Rendering", NULL, NULL);
-    if (window == NULL)
-    {
-        std::cout << "Failed to create GLFW window" << std::endl;
-        glfwTerminate();
+    // 解析命令行参数
+    RenderOptions options;
+    if (!ParseRenderOptions(argc, argv, options))
         return -1;
+    if (options.width > 0 && options.height > 0)
+    {
+        SCR_WIDTH = options.width;
+        SCR_HEIGHT = options.height;
     }
-    glfwMakeContextCurrent(window);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
-    glfwSetCursorPosCallback(window, mouse_callback);
-    glfwSetScrollCallback(window, scroll_callback);
-
-    glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    // 输入回放: 未指定帧数时按录制的帧数跑一遍基准测试
+    InputReplayer replayer;
+    if (!options.replayPath.empty())
+    {
+        if (!replayer.Open(options.replayPath, camera))
+            return -1;
+        if (options.benchmarkFrames <= 0)
+            options.benchmarkFrames = static_cast<int>(replayer.FrameCount);
+    }
+    bool benchmarkMode = options.benchmarkFrames > 0;
+    gBufferLayout = options.gBufferLayout;
 
-    // glad: 加载所有OpenGL函数指针
-    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+    GLFWwindow* window = NULL;
+#ifdef HEADLESS_EGL
+    HeadlessContext headless;
+#endif
+    if (options.headless)
     {
-        std::cout << "Failed to initialize GLAD" << std::endl;
+        // 离屏模式: 不创建窗口，直接创建 EGL surfaceless 上下文
+#ifdef HEADLESS_EGL
+        if (!headless.Create(3, 3))
+            return -1;
+        if (!gladLoadGLLoader((GLADloadproc)HeadlessContext::GetProcAddress))
+        {
+            std::cout << "Failed to initialize GLAD" << std::endl;
+            headless.Destroy();
+            return -1;
+        }
+#else
+        std::cout << "Headless mode is not available: built without EGL support" << std::endl;
         return -1;
+#endif
+    }
+    else
+    {
+        // glfw: 初始化和配置
+        glfwInit();
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        // glfwWindowHint(GLFW_RESIZABLE, GL_FALSE); // 允许调整窗口大小以处理 gbuffer
+
+        // glfw 窗口创建
+        window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Deferred Rendering", NULL, NULL);
+        if (window == NULL)
+        {
+            std::cout << "Failed to create GLFW window" << std::endl;
+            glfwTerminate();
+            return -1;
+        }
+        glfwMakeContextCurrent(window);
+        glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+        glfwSetCursorPosCallback(window, mouse_callback);
+        glfwSetScrollCallback(window, scroll_callback);
+        glfwSetKeyCallback(window, key_callback);
+
+        glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+        // 基准测试时关闭垂直同步，否则测到的只是刷新率
+        if (benchmarkMode)
+            glfwSwapInterval(0);
+
+        // glad: 加载所有OpenGL函数指针
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+        {
+            std::cout << "Failed to initialize GLAD" << std::endl;
+            return -1;
+        }
     }
 
     // 配置全局opengl状态
     glEnable(GL_DEPTH_TEST);
+    // 离屏上下文没有默认帧缓冲，视口初始为 0x0，必须显式设置
+    glViewport(0, 0, SCR_WIDTH, SCR_HEIGHT);
 
     // 构建和编译着色器程序
     std::cout << "Current working directory: " << std::filesystem::current_path() << std::endl;
 
-    Shader shaderGeometryPass("../basic_lighting.vs", "../g_buffer.fs"); // 用于几何阶段
-    Shader shaderLightingPass("../lighting_pass.vs", "../lighting_pass.fs"); // 用于光照阶段
-    Shader shaderLightBox("../light_cube.vs", "../light_cube.fs"); // 光源立方体着色器 (保持不变)
+    // G-buffer 布局通过预处理定义选择着色器变体 (附件格式见 gbuffer.h 中的描述表)
+    std::string gBufferDefines;
+    if (gBufferLayout != GBUFFER_CLASSIC)
+        gBufferDefines += "#define GBUFFER_RECONSTRUCT_POSITION\n";
+    if (gBufferLayout == GBUFFER_PACKED)
+        gBufferDefines += "#define GBUFFER_OCT_NORMALS\n";
+
+    // 法线矩阵由 CPU 预计算时，两个几何阶段变体都改为读取上传的法线矩阵 (阴影阶段的着色器不需要法线)
+    bool precomputedNormals = options.normalMatrixMode == NORMAL_MATRIX_PRECOMPUTED;
+    // 网格顶点格式: 同一张属性描述表驱动网格编码、VAO 设置和所有读取网格的顶点着色器的反量化代码
+    std::vector<VertexAttribute> vertexAttributes = GetVertexAttributes(options.vertexFormat);
+    std::string vertexDefines = GetVertexFormatDefines(vertexAttributes);
+    std::string geometryDefines = gBufferDefines + vertexDefines + (precomputedNormals ? "#define PRECOMPUTED_NORMAL_MATRIX\n" : "");
+    Shader shaderGeometryPass("../basic_lighting.vs", "../g_buffer.fs", geometryDefines); // 用于几何阶段
+    // 连续 LOD 只作用于实例化场景，实例按级别分组由 CPU 提交，只支持不剔除和 CPU 视锥体剔除
+    bool lodEnabled = options.lod && options.instanceCount > 0;
+    if (lodEnabled && options.cullingMode != CULLING_OFF && options.cullingMode != CULLING_FRUSTUM)
+    {
+        std::cout << "LOD is only supported with --culling off or frustum, disabled" << std::endl;
+        lodEnabled = false;
+    }
+    // 实例化压力测试: 模型矩阵来自实例属性的几何阶段变体 (GPU 剔除时所有物体都经过这个变体绘制)
+    bool instancedGeometry = options.instanceCount > 0 || options.cullingMode == CULLING_GPU || options.cullingMode == CULLING_HIZ;
+    Shader shaderGeometryInstanced;
+    if (instancedGeometry)
+        shaderGeometryInstanced = Shader("../basic_lighting.vs", "../g_buffer.fs",
+                                         geometryDefines + "#define INSTANCED\n" + (lodEnabled ? "#define LOD_CROSSFADE\n" : ""));
+    // 多材质场景: 第二种材质着色器变体 (镜面强度取自反照率)；单独绘制的物体按需经过绘制队列
+    bool materialSceneEnabled = options.materialObjects > 0;
+    bool useRenderQueue = options.renderQueue || materialSceneEnabled;
+    Shader shaderGeometrySpecular;
+    if (materialSceneEnabled)
+        shaderGeometrySpecular = Shader("../basic_lighting.vs", "../g_buffer.fs", geometryDefines + "#define SPECULAR_FROM_ALBEDO\n");
+    // 光照阶段的着色器要等光照路径和阴影创建完再编译 (见下文)
+    Shader shaderLightBox("../light_cube.vs", "../light_cube.fs", vertexDefines); // 光源立方体着色器
 
     // 检查着色器是否加载成功
-     if (shaderGeometryPass.ID == 0 || shaderLightingPass.ID == 0 || shaderLightBox.ID == 0) {
+     if (shaderGeometryPass.ID == 0 || shaderLightBox.ID == 0 ||
+         (instancedGeometry && shaderGeometryInstanced.ID == 0) || (materialSceneEnabled && shaderGeometrySpecular.ID == 0)) {
         std::cerr << "ERROR::SHADER::COMPILATION_FAILED\n" <<
                      (shaderGeometryPass.ID == 0 ? "Geometry Pass Shader failed\n" : "") <<
-                     (shaderLightingPass.ID == 0 ? "Lighting Pass Shader failed\n" : "") <<
+                     (instancedGeometry && shaderGeometryInstanced.ID == 0 ? "Instanced Geometry Pass Shader failed\n" : "") <<
+                     (materialSceneEnabled && shaderGeometrySpecular.ID == 0 ? "Specular Geometry Pass Shader failed\n" : "") <<
                      (shaderLightBox.ID == 0 ? "Light Box Shader failed\n" : "") << std::endl;
         glfwTerminate();
         return -1;
@@ -141,30 +265,54 @@ int main()
         -0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 0.0f,
         -0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f, 1.0f
     };
-    // 配置立方体 VAO 和 VBO (用于几何阶段和光源立方体)
-    unsigned int cubeVAO, cubeVBO;
+    // 立方体网格: 焊接重复顶点后生成索引缓冲，并按顶点缓存/overdraw/顶点读取优化 (见 mesh.h)
+    Mesh cubeMesh;
+    cubeMesh.Build(vertices, 36, 8);
+    cubeMesh.Upload(vertexAttributes);
+    cubeMesh.PrintSummary("cube");
+    // 配置立方体 VAO (用于几何阶段和阴影阶段，属性指针由顶点格式描述表设置)
+    unsigned int cubeVAO;
     glGenVertexArrays(1, &cubeVAO);
-    glGenBuffers(1, &cubeVBO);
     glBindVertexArray(cubeVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
-    glEnableVertexAttribArray(0); // 位置
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-    glEnableVertexAttribArray(1); // 法线
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-    glEnableVertexAttribArray(2); // 纹理坐标
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+    cubeMesh.SetupAttributes();
     glBindVertexArray(0); // 解绑 cubeVAO
 
-    // 配置光源立方体 VAO (复用 cubeVBO，但属性指针不同)
+    // 配置光源立方体 VAO (复用立方体网格的缓冲，light_cube.vs 只读取位置)
     unsigned int lightCubeVAO;
     glGenVertexArrays(1, &lightCubeVAO);
     glBindVertexArray(lightCubeVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, cubeVBO);
-    glEnableVertexAttribArray(0); // 只需要位置
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+    cubeMesh.SetupAttributes();
     glBindVertexArray(0); // 解绑 lightCubeVAO
 
+    // 连续 LOD: 实例化场景改用程序化的高面数岩石 (包在单位立方体内，包围盒沿用立方体的)，
+    // LOD 链在加载时用二次误差简化一次生成 (见 mesh_lod.h)
+    const int rockSubdivisions = 5; // 20480 个三角形
+    MeshLod rockLod;
+    if (lodEnabled)
+    {
+        std::vector<float> rockVertices;
+        std::vector<uint32_t> rockIndices;
+        GenerateRockMesh(rockSubdivisions, 11, rockVertices, rockIndices);
+        rockLod.Build(rockVertices.data(), static_cast<int>(rockVertices.size() / 8), 8, rockIndices);
+        rockLod.Upload(vertexAttributes);
+        rockLod.PrintSummary("rock");
+    }
+
+    // 实例化压力测试场景 (复用立方体网格，另加实例矩阵缓冲)
+    InstancedScene instancedScene;
+    if (options.instanceCount > 0)
+    {
+        const Mesh& instanceMesh = lodEnabled ? rockLod.Levels[0] : cubeMesh;
+        instancedScene.Create(instanceMesh, options.instanceCount, precomputedNormals);
+        if (lodEnabled)
+            instancedScene.CreateLod(rockLod);
+        std::cout << "Instanced scene: " << instancedScene.MaxInstances << (lodEnabled ? " rocks (" : " cubes (")
+                  << static_cast<long long>(instancedScene.MaxInstances) * instanceMesh.TriangleCount() << " triangles at full detail)"
+                  << (options.instanceRamp && benchmarkMode ? ", ramped over the benchmark" : "") << std::endl;
+        if (precomputedNormals)
+            std::cout << "Instance normal matrices precomputed in " << instancedScene.NormalMatrixMs << " ms" << std::endl;
+    }
+
     // 加载纹理
     unsigned int diffuseMap = loadTexture("../stone.jpg");
     if (diffuseMap == 0) {
@@ -172,110 +320,596 @@ int main()
         return -1;
     }
 
+    // 多材质场景: 立方体和低模岩石两种网格，materialCount 种染色纹理 x 2 种着色器变体
+    Mesh smallRockMesh;
+    unsigned int smallRockVAO = 0;
+    MaterialScene materialScene;
+    if (materialSceneEnabled)
+    {
+        std::vector<float> rockVertices;
+        std::vector<uint32_t> rockIndices;
+        GenerateRockMesh(2, 7, rockVertices, rockIndices); // 320 个三角形
+        smallRockMesh.Build(rockVertices.data(), static_cast<int>(rockVertices.size() / 8), 8, rockIndices);
+        smallRockMesh.Upload(vertexAttributes);
+        glGenVertexArrays(1, &smallRockVAO);
+        glBindVertexArray(smallRockVAO);
+        smallRockMesh.SetupAttributes();
+        glBindVertexArray(0);
+        // 放在实例化场景的全部格点之外 (实例数渐增时也不会与之相交)
+        if (!materialScene.Create("../stone.jpg", options.materialObjects, options.materialCount, instancedScene.MaxInstances))
+        {
+            glfwTerminate();
+            return -1;
+        }
+        std::cout << "Material scene: " << materialScene.Objects.size() << " objects, " << materialScene.Materials.size()
+                  << " materials" << (options.renderQueue ? ", sorted render queue" : ", submission order") << std::endl;
+    }
+    RenderQueue renderQueue;
+
 
     // --- 配置 G-buffer 帧缓冲 ---
-    glGenFramebuffers(1, &gBuffer);
-    glBindFramebuffer(GL_FRAMEBUFFER, gBuffer);
-
-    // 位置颜色缓冲
-    glGenTextures(1, &gPosition);
-    glBindTexture(GL_TEXTURE_2D, gPosition);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGB, GL_FLOAT, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, gPosition, 0);
-
-    // 法线颜色缓冲
-    glGenTextures(1, &gNormal);
-    glBindTexture(GL_TEXTURE_2D, gNormal);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGB, GL_FLOAT, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, gNormal, 0);
-
-    // 颜色 + 镜面颜色缓冲
-    glGenTextures(1, &gAlbedoSpec);
-    glBindTexture(GL_TEXTURE_2D, gAlbedoSpec);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT2, GL_TEXTURE_2D, gAlbedoSpec, 0);
-
-    // 告诉 OpenGL 我们要绘制到哪些颜色附件
-    unsigned int attachments[3] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2 };
-    glDrawBuffers(3, attachments);
-
-    // 创建并附加深度缓冲
-    glGenRenderbuffers(1, &rboDepth);
-    glBindRenderbuffer(GL_RENDERBUFFER, rboDepth);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, SCR_WIDTH, SCR_HEIGHT);
-    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, rboDepth);
-    // 检查帧缓冲是否完整
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
-        std::cout << "Framebuffer not complete!" << std::endl;
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-
-    // 光照阶段着色器配置
-    shaderLightingPass.use();
-    shaderLightingPass.setInt("gPosition", 0);
-    shaderLightingPass.setInt("gNormal", 1);
-    shaderLightingPass.setInt("gAlbedoSpec", 2);
+    gBuffer.Create(gBufferLayout, SCR_WIDTH, SCR_HEIGHT);
+    const char* layoutNames[] = { "classic", "depth", "packed" };
+    std::cout << "G-buffer layout: " << layoutNames[gBufferLayout] << " (" << gBuffer.BytesPerPixel() << " B/px)" << std::endl;
+
+    // 点光源: 主光源 (原来的 lightPos) + --lights 指定数量的动态光源
+    LightField lightField;
+    lightField.Create(lightPos, glm::vec3(1.0f), options.lightCount);
+    float lightAnimationTime = 0.0f;
+
+    // 光照路径: 分块计算着色器不可用时回退到全屏四边形
+    LightingPath lightingPath = options.lightingPath;
+    TiledLighting tiledLighting;
+    if (lightingPath == LIGHTING_TILED && !tiledLighting.Create(gBufferDefines, gBuffer))
+    {
+        std::cout << "Tiled lighting unavailable, falling back to full-screen quad lighting" << std::endl;
+        lightingPath = LIGHTING_QUAD;
+    }
+    // 光源体积路径的着色器编译失败时同样回退
+    LightVolumes lightVolumes;
+    if (lightingPath == LIGHTING_VOLUMES && !lightVolumes.Create(gBufferDefines, gBuffer, options.lightQueries))
+    {
+        std::cout << "Light volumes unavailable, falling back to full-screen quad lighting" << std::endl;
+        lightVolumes.Destroy();
+        lightingPath = LIGHTING_QUAD;
+    }
+    // 光照阶段的光源数据放在 uniform block 中，每帧一次上传
+    LightBuffer lightBuffer;
+    lightBuffer.Create();
+    if (lightingPath == LIGHTING_QUAD && lightField.Lights.size() > static_cast<size_t>(LightBuffer::MaxLights))
+        std::cout << "Quad lighting shades at most " << LightBuffer::MaxLights << " lights, "
+                  << lightField.Lights.size() - LightBuffer::MaxLights << " extra lights ignored" << std::endl;
+    ThreadPool threadPool(static_cast<unsigned int>(std::max(options.threadCount, 0)));
+    ClusteredLighting clusteredLighting;
+    // 方向光级联阴影 (分块光照路径不经过 lighting_pass.fs，不支持)
+    CascadedShadowMaps cascadedShadows;
+    bool shadowsEnabled = options.shadowMode != SHADOWS_OFF;
+    if (shadowsEnabled && lightingPath == LIGHTING_TILED)
+    {
+        std::cout << "Cascaded shadows are not supported by tiled lighting, disabled" << std::endl;
+        shadowsEnabled = false;
+    }
+    if (shadowsEnabled && !cascadedShadows.Create(options.shadowMode == SHADOWS_CACHED, vertexDefines))
+    {
+        std::cout << "Cascaded shadows unavailable, disabled" << std::endl;
+        shadowsEnabled = false;
+    }
+    // 点光源全向阴影，全部光源共用一张图集 (同样只在 lighting_pass.fs 中采样)
+    PointShadowMaps pointShadows;
+    bool pointShadowsEnabled = options.pointShadowCount > 0 && lightingPath != LIGHTING_TILED && lightingPath != LIGHTING_VOLUMES;
+    if (options.pointShadowCount > 0 && !pointShadowsEnabled)
+        std::cout << "Point shadows are only supported by quad and clustered lighting, disabled" << std::endl;
+    if (pointShadowsEnabled && !pointShadows.Create(std::min(options.pointShadowCount, static_cast<int>(lightField.Lights.size())), options.shadowAtlasMB, vertexDefines))
+    {
+        std::cout << "Point shadows unavailable, disabled" << std::endl;
+        pointShadowsEnabled = false;
+    }
+
+    // 光照阶段着色器: 只为实际创建成功的光照路径和阴影加入预处理定义，
+    // 否则着色器中未绑定的阴影采样器会与 G-buffer 采样器共用纹理单元 0，每次绘制都失败
+    std::string lightingDefines = gBufferDefines + LightBuffer::Defines();
+    if (lightingPath == LIGHTING_CLUSTERED)
+        lightingDefines += "#define CLUSTERED_LIGHTING\n";
+    else if (lightingPath == LIGHTING_VOLUMES)
+        lightingDefines += "#define LIGHT_VOLUMES\n";
+    if (shadowsEnabled)
+        lightingDefines += "#define CASCADED_SHADOWS\n#define CASCADE_COUNT " + std::to_string(CascadedShadowMaps::CascadeCount) + "\n";
+    if (pointShadowsEnabled)
+        lightingDefines += "#define POINT_SHADOWS\n";
+    Shader shaderLightingPass("../lighting_pass.vs", "../lighting_pass.fs", lightingDefines); // 用于光照阶段
+    if (shaderLightingPass.ID == 0)
+    {
+        std::cerr << "ERROR::SHADER::COMPILATION_FAILED\nLighting Pass Shader failed\n" << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    gBuffer.SetSamplerUniforms(shaderLightingPass);
+    LightBuffer::BindBlock(shaderLightingPass);
+    if (lightingPath == LIGHTING_CLUSTERED)
+        clusteredLighting.Create(shaderLightingPass, NEAR_PLANE, FAR_PLANE);
+    if (shadowsEnabled)
+        cascadedShadows.BindLightingShader(shaderLightingPass);
+    if (pointShadowsEnabled)
+        pointShadows.BindLightingShader(shaderLightingPass);
+    // 场景: 原点的立方体，开启任一种阴影时再加入地面 (静态投射物) 和一个绕原点运动的小立方体 (动态投射物)
+    bool shadowScene = shadowsEnabled || pointShadowsEnabled;
+    float sceneAnimationTime = 0.0f;
+    // 设置单个物体的模型矩阵，预计算模式下同时上传法线矩阵 (阴影着色器中没有 normalMatrix，glUniform 对 -1 位置无效果)
+    auto setModel = [&](const Shader& shader, const glm::mat4& modelMatrix) {
+        shader.setMat4("model", modelMatrix);
+        cubeMesh.SetPositionUniforms(shader);
+        if (precomputedNormals)
+            shader.setMat3("normalMatrix", ComputeNormalMatrix(modelMatrix));
+    };
+    const float dynamicCubeScale = 0.6f;
+    auto dynamicCubeModel = [&]() {
+        glm::mat4 orbitModel = glm::rotate(glm::mat4(1.0f), sceneAnimationTime * 0.5f, glm::vec3(0.0f, 1.0f, 0.0f));
+        orbitModel = glm::translate(orbitModel, glm::vec3(2.0f, -1.0f, 0.0f));
+        orbitModel = glm::rotate(orbitModel, sceneAnimationTime * 1.3f, glm::vec3(1.0f, 1.0f, 0.0f));
+        return glm::scale(orbitModel, glm::vec3(dynamicCubeScale));
+    };
+    // 单独绘制的场景物体 (实例化场景之外): 原点的立方体，开启阴影时还有地面和运动的立方体
+    enum SceneObject { OBJECT_CUBE, OBJECT_FLOOR, OBJECT_DYNAMIC_CUBE };
+    const int sceneObjectCount = shadowScene ? 3 : 1;
+    auto sceneObjectModel = [&](int object) {
+        if (object == OBJECT_FLOOR)
+        {
+            // 地面: 压扁的立方体，顶面在 y = -2 (基准测试摄像机最低到 y = -1.5)
+            glm::mat4 floorModel = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, -2.1f, 0.0f));
+            return glm::scale(floorModel, glm::vec3(20.0f, 0.2f, 20.0f));
+        }
+        if (object == OBJECT_DYNAMIC_CUBE)
+            return dynamicCubeModel();
+        return glm::mat4(1.0f); // 被照射立方体的模型矩阵 (单位矩阵，在原点)
+    };
+    auto drawSceneObject = [&](const Shader& shader, int object) {
+        glBindVertexArray(cubeVAO);
+        setModel(shader, sceneObjectModel(object));
+        cubeMesh.Draw();
+        glBindVertexArray(0);
+    };
+    auto drawStaticScene = [&](const Shader& shader) {
+        drawSceneObject(shader, OBJECT_CUBE);
+        if (shadowScene)
+            drawSceneObject(shader, OBJECT_FLOOR);
+    };
+    auto drawDynamicScene = [&](const Shader& shader) {
+        if (shadowScene)
+            drawSceneObject(shader, OBJECT_DYNAMIC_CUBE);
+    };
+    auto drawShadowCasters = [&](const Shader& shader) {
+        drawStaticScene(shader);
+        drawDynamicScene(shader);
+    };
+    // 运动投射物的包围球 (点光源阴影缓存据此判断失效)
+    std::vector<CasterBounds> movingCasters;
+
+    // 剔除: 单独绘制的物体在前，实例化场景的实例从 sceneObjectCount 开始编号
+    CullingMode cullingMode = options.cullingMode;
+    const Aabb unitCubeBounds = { glm::vec3(-0.5f), glm::vec3(0.5f) };
+    // GPU 剔除: 全部物体的矩阵常驻显存，计算着色器生成间接绘制命令；不可用时回退到 CPU 视锥体剔除
+    // hiz 模式另外从 G-buffer 深度构建 Hi-Z 金字塔做两阶段遮挡剔除
+    GpuCulling gpuCulling;
+    HiZPyramid hiZPyramid;
+    if (cullingMode == CULLING_HIZ && !hiZPyramid.Create())
+    {
+        std::cout << "Hi-Z occlusion culling unavailable, using GPU frustum culling only" << std::endl;
+        cullingMode = CULLING_GPU;
+    }
+    if (cullingMode == CULLING_GPU || cullingMode == CULLING_HIZ)
+    {
+        std::vector<glm::mat4> sceneModels;
+        for (int object = 0; object < sceneObjectCount; ++object)
+            sceneModels.push_back(sceneObjectModel(object));
+        if (gpuCulling.Create(cubeMesh, sceneModels, instancedScene, unitCubeBounds, precomputedNormals, cullingMode == CULLING_HIZ))
+            std::cout << "GPU culling: " << gpuCulling.ObjectCount << " objects, "
+                      << (cullingMode == CULLING_HIZ ? "two-phase Hi-Z occlusion, " : "") << "multi-draw indirect" << std::endl;
+        else
+        {
+            std::cout << "GPU culling unavailable, falling back to CPU frustum culling" << std::endl;
+            cullingMode = CULLING_FRUSTUM;
+        }
+    }
+    bool gpuDrivenCulling = cullingMode == CULLING_GPU || cullingMode == CULLING_HIZ;
+    // CPU 视锥体剔除: 全部物体放进一棵 BVH；software 模式再对可见列表做软件光栅化的遮挡剔除
+    bool frustumCulling = cullingMode == CULLING_FRUSTUM || cullingMode == CULLING_SOFTWARE;
+    SoftwareOcclusion softwareOcclusion;
+    if (cullingMode == CULLING_SOFTWARE)
+    {
+        softwareOcclusion.Create(cubeMesh, SCR_WIDTH, SCR_HEIGHT);
+        std::cout << "Software occlusion: " << SoftwareOcclusion::Width << "x" << softwareOcclusion.Height
+                  << " depth buffer, up to " << SoftwareOcclusion::MaxOccluders << " occluders" << std::endl;
+    }
+    // 硬件遮挡查询: 实例按空间分簇，簇的包围盒作为代理，真正的绘制按上一帧的查询结果条件渲染
+    bool queryCulling = cullingMode == CULLING_QUERIES;
+    const int clusterHysteresisFrames = 8;
+    OcclusionQueries clusterQueries;
+    std::vector<char> clusterInFrustum;
+    if (queryCulling)
+    {
+        if (instancedScene.MaxInstances > 0 && clusterQueries.Create(clusterHysteresisFrames))
+        {
+            instancedScene.CreateClusters(unitCubeBounds);
+            std::cout << "Occlusion queries: " << instancedScene.Clusters.size() << " instance clusters, hysteresis "
+                      << clusterHysteresisFrames << " frames" << std::endl;
+        }
+        else
+            queryCulling = false;
+    }
+    SceneBvh sceneBvh;
+    std::vector<uint32_t> visibleObjects;   // 本帧可见物体 (BVH 输出的紧凑列表)
+    std::vector<uint32_t> visibleInstances; // 其中属于实例化场景的部分 (实例下标)
+    if (frustumCulling)
+    {
+        std::vector<Aabb> objectBounds;
+        for (int object = 0; object < sceneObjectCount; ++object)
+            objectBounds.push_back(Aabb::Transform(unitCubeBounds, sceneObjectModel(object)));
+        for (const glm::mat4& transform : instancedScene.Transforms)
+            objectBounds.push_back(Aabb::Transform(unitCubeBounds, transform));
+        sceneBvh.Build(objectBounds);
+        std::cout << "Scene BVH: " << sceneBvh.ObjectCount() << " objects, " << sceneBvh.Nodes.size() << " nodes, depth "
+                  << sceneBvh.Depth << ", SAH build " << sceneBvh.BuildMs << " ms" << std::endl;
+    }
+
+    const char* lightingNames[] = { "quad", "tiled", "clustered", "volumes" };
+    std::cout << "Lighting: " << lightingNames[lightingPath] << ", " << lightField.Lights.size() << " lights, "
+              << threadPool.ThreadCount() << " threads" << std::endl;
+
+    // 离屏模式的输出目标
+    OffscreenTarget offscreen;
+    if (options.headless)
+    {
+        if (!offscreen.Create(SCR_WIDTH, SCR_HEIGHT))
+            return -1;
+        outputFBO = offscreen.FBO;
+    }
+
+    // 输入录制
+    InputRecorder recorder;
+    if (!options.recordPath.empty() && !recorder.Open(options.recordPath, camera))
+        return -1;
+
+    // 基准测试: 每帧 CPU/GPU 耗时
+    FrameTimer frameTimer;
+    int frameIndex = 0;
+    int objectsDrawn = 0; // 本帧几何阶段绘制的物体数 (写入 CSV 的 objects 列)
+    long long trianglesDrawn = 0; // 本帧几何阶段提交的三角形数 (CSV 的 triangles 列)
+
+    // 各渲染阶段的 GPU 耗时
+    GpuProfiler gpuProfiler;
+    gpuProfiler.RecordHistory = !options.gpuCsvPath.empty();
+    const int passGeometry = gpuProfiler.RegisterPass("geometry");
+    const int passLighting = gpuProfiler.RegisterPass("lighting");
+    const int passDepthBlit = gpuProfiler.RegisterPass("depth_blit");
+    const int passLightBox = gpuProfiler.RegisterPass("light_box");
+    const int passShadows = shadowsEnabled ? gpuProfiler.RegisterPass("shadows") : -1;
+    const int passPointShadows = pointShadowsEnabled ? gpuProfiler.RegisterPass("point_shadows") : -1;
+    double lastTitleUpdate = 0.0;
+
+    // 复制 G-buffer 的深度信息到输出帧缓冲 (两者都是 D24S8)
+    auto blitGBufferDepth = [&]() {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, gBuffer.FBO);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, outputFBO); // 写入到输出帧缓冲
+        glBlitFramebuffer(0, 0, SCR_WIDTH, SCR_HEIGHT, 0, 0, SCR_WIDTH, SCR_HEIGHT, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, outputFBO);
+    };
 
     // 渲染循环
-    while (!glfwWindowShouldClose(window))
+    while (benchmarkMode ? frameIndex < options.benchmarkFrames : !glfwWindowShouldClose(window))
     {
-        float currentFrame = static_cast<float>(glfwGetTime());
-        deltaTime = currentFrame - lastFrame;
-        lastFrame = currentFrame;
+        CPU_PROFILE_SCOPE("frame");
+        auto frameStart = std::chrono::steady_clock::now();
+        if (benchmarkMode)
+        {
+            // 固定 deltaTime 使每次运行结果可复现
+            deltaTime = 1.0f / 60.0f;
+            frameTimer.BeginFrame(frameIndex);
+        }
+        else
+        {
+            float currentFrame = static_cast<float>(glfwGetTime());
+            deltaTime = currentFrame - lastFrame;
+            lastFrame = currentFrame;
+        }
+
+        if (window)
+            processInput(window);
+
+        // 摄像机驱动: 回放录制文件 > 脚本化基准测试路径 > 实时输入
+        if (replayer.IsOpen())
+        {
+            FrameInput replayed;
+            float recordedDeltaTime;
+            if (replayer.Next(replayed, recordedDeltaTime))
+            {
+                deltaTime = options.fixedDeltaTime > 0.0f ? options.fixedDeltaTime : recordedDeltaTime;
+                ApplyFrameInput(camera, replayed, deltaTime);
+            }
+        }
+        else if (benchmarkMode)
+        {
+            ApplyBenchmarkCameraPath(camera, frameIndex, options.benchmarkFrames);
+        }
+        else
+        {
+            if (recorder.IsOpen())
+                recorder.Write(frameInput, deltaTime);
+            ApplyFrameInput(camera, frameInput, deltaTime);
+        }
+        frameInput.Clear();
 
-        processInput(window);
+        // 窗口缩小后稳定一段时间再缩小 G-buffer
+        if (window)
+            gBuffer.Update(glfwGetTime());
 
+        sceneAnimationTime += deltaTime;
+
+        gpuProfiler.BeginFrame();
+        glBindFramebuffer(GL_FRAMEBUFFER, outputFBO);
         glClearColor(0.1f, 0.1f, 0.1f, 1.0f); // 设置默认背景色
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         // 1. 几何阶段: 渲染场景几何信息到 G-buffer
         // ----------------------------------------------------
-        glBindFramebuffer(GL_FRAMEBUFFER, gBuffer);
+        gpuProfiler.BeginPass(passGeometry);
+        glBindFramebuffer(GL_FRAMEBUFFER, gBuffer.FBO);
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // 清除 G-Buffer
-            glm::mat4 projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, 0.1f, 100.0f);
-            glm::mat4 view = camera.GetViewMatrix();
-            glm::mat4 model = glm::mat4(1.0f);
+            glm::mat4 projection, view, model;
+            {
+                CPU_PROFILE_SCOPE("matrix_setup");
+                projection = glm::perspective(glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, NEAR_PLANE, FAR_PLANE);
+                view = camera.GetViewMatrix();
+                model = glm::mat4(1.0f);
+            }
             shaderGeometryPass.use();
             shaderGeometryPass.setMat4("projection", projection);
             shaderGeometryPass.setMat4("view", view);
-            shaderGeometryPass.setMat4("model", model); // 被照射立方体的模型矩阵 (单位矩阵，在原点)
             glActiveTexture(GL_TEXTURE0);
             glBindTexture(GL_TEXTURE_2D, diffuseMap);
             shaderGeometryPass.setInt("texture_diffuse1", 0); // 对应 g_buffer.fs 中的 texture_diffuse1
-            glBindVertexArray(cubeVAO); // 使用立方体的 VAO (包含位置、法线、纹理坐标)
-            glDrawArrays(GL_TRIANGLES, 0, 36);
-            glBindVertexArray(0);
-        glBindFramebuffer(GL_FRAMEBUFFER, 0); // 解绑 G-Buffer
+            if (materialSceneEnabled)
+            {
+                shaderGeometrySpecular.use();
+                shaderGeometrySpecular.setMat4("projection", projection);
+                shaderGeometrySpecular.setMat4("view", view);
+                shaderGeometrySpecular.setInt("texture_diffuse1", 0);
+            }
+            // 单独绘制的物体: 使用绘制队列时只提交，等全部提交完再统一执行
+            if (useRenderQueue)
+                renderQueue.Begin(view, NEAR_PLANE, FAR_PLANE);
+            auto drawGeometryObject = [&](int object) {
+                if (useRenderQueue)
+                    renderQueue.Submit(shaderGeometryPass, diffuseMap, cubeVAO, cubeMesh, sceneObjectModel(object));
+                else
+                    drawSceneObject(shaderGeometryPass, object);
+            };
+            int instances = options.instanceCount <= 0 ? 0
+                            : options.instanceRamp && benchmarkMode ? instancedScene.RampCount(frameIndex, options.benchmarkFrames)
+                                                                    : instancedScene.MaxInstances;
+            int lodInstancesDrawn = 0;
+            long long lodTrianglesDrawn = 0;
+            if (gpuDrivenCulling)
+            {
+                // 只上传运动物体的新矩阵，剔除和可见列表的生成都在 GPU 上
+                if (shadowScene)
+                    gpuCulling.UpdateObject(OBJECT_DYNAMIC_CUBE, dynamicCubeModel());
+                gpuCulling.Cull(Frustum::FromMatrix(projection * view), instances);
+                objectsDrawn = 0;
+            }
+            else if (frustumCulling)
+            {
+                // 运动物体先 refit，再按本帧摄像机剔除；可见列表中的单独物体直接画，实例收集起来一次绘制
+                if (shadowScene)
+                    sceneBvh.UpdateObject(OBJECT_DYNAMIC_CUBE, Aabb::Transform(unitCubeBounds, dynamicCubeModel()));
+                sceneBvh.Cull(Frustum::FromMatrix(projection * view), threadPool, visibleObjects);
+                if (cullingMode == CULLING_SOFTWARE)
+                {
+                    // 本帧不绘制的实例 (实例数渐增时) 不能作为遮挡物
+                    uint32_t drawnObjects = static_cast<uint32_t>(sceneObjectCount + instances);
+                    visibleObjects.erase(std::remove_if(visibleObjects.begin(), visibleObjects.end(),
+                                                        [&](uint32_t object) { return object >= drawnObjects; }),
+                                         visibleObjects.end());
+                    softwareOcclusion.Cull(projection * view, sceneBvh, [&](uint32_t object) {
+                        if (object < static_cast<uint32_t>(sceneObjectCount))
+                            return sceneObjectModel(static_cast<int>(object));
+                        return instancedScene.Transforms[object - sceneObjectCount];
+                    }, threadPool, visibleObjects);
+                }
+                visibleInstances.clear();
+                objectsDrawn = 0;
+                for (uint32_t object : visibleObjects)
+                {
+                    if (object < static_cast<uint32_t>(sceneObjectCount))
+                    {
+                        drawGeometryObject(static_cast<int>(object));
+                        ++objectsDrawn;
+                    }
+                    else if (object - sceneObjectCount < static_cast<uint32_t>(instances))
+                        visibleInstances.push_back(object - sceneObjectCount);
+                }
+            }
+            else
+            {
+                for (int object = 0; object < sceneObjectCount; ++object)
+                    drawGeometryObject(object);
+                objectsDrawn = sceneObjectCount;
+            }
+            int materialTriangles = 0;
+            if (useRenderQueue)
+            {
+                // 多材质物体不参与剔除，全部提交
+                for (const MaterialScene::Object& object : materialScene.Objects)
+                {
+                    const MaterialScene::Material& material = materialScene.Materials[object.Material];
+                    const Shader& program = material.Variant == 0 ? shaderGeometryPass : shaderGeometrySpecular;
+                    if (object.MeshKind == 0)
+                        renderQueue.Submit(program, material.Texture, cubeVAO, cubeMesh, object.Model);
+                    else
+                        renderQueue.Submit(program, material.Texture, smallRockVAO, smallRockMesh, object.Model);
+                    materialTriangles += object.MeshKind == 0 ? cubeMesh.TriangleCount() : smallRockMesh.TriangleCount();
+                }
+                objectsDrawn += static_cast<int>(materialScene.Objects.size());
+                renderQueue.Execute(options.renderQueue, precomputedNormals);
+                // 队列执行后纹理单元 0 上是最后一项的纹理，实例化绘制仍使用基础纹理
+                glBindTexture(GL_TEXTURE_2D, diffuseMap);
+            }
+            if (instances > 0 || gpuDrivenCulling)
+            {
+                shaderGeometryInstanced.use();
+                shaderGeometryInstanced.setMat4("projection", projection);
+                shaderGeometryInstanced.setMat4("view", view);
+                shaderGeometryInstanced.setInt("texture_diffuse1", 0);
+                cubeMesh.SetPositionUniforms(shaderGeometryInstanced);
+                if (gpuDrivenCulling)
+                {
+                    gpuCulling.Draw(0);
+                    if (cullingMode == CULLING_HIZ)
+                    {
+                        // 第一阶段 (上一帧可见的物体) 的深度构建 Hi-Z，剩下的物体测试后补画
+                        hiZPyramid.Build(gBuffer);
+                        gpuCulling.CullOccluded(Frustum::FromMatrix(projection * view), projection * view, hiZPyramid, instances);
+                        shaderGeometryInstanced.use();
+                        gpuCulling.Draw(1);
+                    }
+                    objectsDrawn += gpuCulling.VisibleCount; // 回读有几帧延迟
+                }
+                else if (queryCulling)
+                {
+                    // 视锥体外的簇不画也不查询；条件渲染跳过的实例仍计入 objectsDrawn (CPU 不知道结果)
+                    glm::mat4 viewProjection = projection * view;
+                    Frustum frustum = Frustum::FromMatrix(viewProjection);
+                    int clusterCount = static_cast<int>(instancedScene.Clusters.size());
+                    clusterQueries.BeginFrame(clusterCount);
+                    clusterInFrustum.resize(clusterCount);
+                    for (int cluster = 0; cluster < clusterCount; ++cluster)
+                    {
+                        clusterInFrustum[cluster] = frustum.Intersects(instancedScene.Clusters[cluster].Bounds);
+                        if (!clusterInFrustum[cluster])
+                            continue;
+                        clusterQueries.BeginConditional(cluster);
+                        objectsDrawn += instancedScene.DrawCluster(cluster, instances);
+                        clusterQueries.EndConditional(cluster);
+                    }
+                    // 整帧几何画完之后对本帧的深度发出代理查询，结果在下一帧使用
+                    clusterQueries.BeginProxies(viewProjection, camera.Position, NEAR_PLANE);
+                    for (int cluster = 0; cluster < clusterCount; ++cluster)
+                    {
+                        if (clusterInFrustum[cluster])
+                            clusterQueries.Proxy(cluster, instancedScene.Clusters[cluster].Bounds);
+                        else
+                            clusterQueries.Skip(cluster);
+                    }
+                    clusterQueries.EndProxies();
+                }
+                else if (lodEnabled)
+                {
+                    // 不剔除时候选就是前 instances 个实例
+                    if (!frustumCulling)
+                    {
+                        visibleInstances.resize(instances);
+                        std::iota(visibleInstances.begin(), visibleInstances.end(), 0u);
+                    }
+                    float pixelsPerUnit = SCR_HEIGHT / (2.0f * std::tan(glm::radians(camera.Zoom) * 0.5f));
+                    float maxPixelError = options.lodRamp && benchmarkMode
+                                              ? options.lodError * (frameIndex + 1) / options.benchmarkFrames
+                                              : options.lodError;
+                    instancedScene.DrawLod(shaderGeometryInstanced, visibleInstances, camera.Position, pixelsPerUnit, maxPixelError);
+                    lodInstancesDrawn = static_cast<int>(visibleInstances.size());
+                    lodTrianglesDrawn = instancedScene.Lod.FrameTriangles;
+                    objectsDrawn += lodInstancesDrawn;
+                }
+                else if (frustumCulling)
+                {
+                    instancedScene.DrawVisible(visibleInstances);
+                    objectsDrawn += static_cast<int>(visibleInstances.size());
+                }
+                else
+                {
+                    instancedScene.Draw(instances);
+                    objectsDrawn += instances;
+                }
+            }
+            // 除 LOD 实例和多材质物体之外的物体都是立方体
+            int materialObjectsDrawn = static_cast<int>(materialScene.Objects.size());
+            trianglesDrawn = static_cast<long long>(objectsDrawn - lodInstancesDrawn - materialObjectsDrawn) * cubeMesh.TriangleCount()
+                             + lodTrianglesDrawn + materialTriangles;
+        glBindFramebuffer(GL_FRAMEBUFFER, outputFBO); // 解绑 G-Buffer，回到输出帧缓冲
+        gpuProfiler.EndPass(passGeometry);
+
+        // 1.5. 阴影阶段: 按需更新各级联的阴影贴图
+        // ----------------------------------------------------
+        if (shadowsEnabled)
+        {
+            gpuProfiler.BeginPass(passShadows);
+            cascadedShadows.Update(view, glm::radians(camera.Zoom), (float)SCR_WIDTH / (float)SCR_HEIGHT, NEAR_PLANE,
+                                 drawStaticScene, drawDynamicScene);
+            glBindFramebuffer(GL_FRAMEBUFFER, outputFBO);
+            gpuProfiler.EndPass(passShadows);
+        }
 
         // 2. 光照阶段: 使用 G-buffer 计算光照
         // ----------------------------------------------------
-        shaderLightingPass.use();
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, gPosition);
-        glActiveTexture(GL_TEXTURE1);
-        glBindTexture(GL_TEXTURE_2D, gNormal);
-        glActiveTexture(GL_TEXTURE2);
-        glBindTexture(GL_TEXTURE_2D, gAlbedoSpec);
-        // 发送光照 uniforms
-        shaderLightingPass.setVec3("lightPos", lightPos); // 传递原始的光源位置
-        shaderLightingPass.setVec3("viewPos", camera.Position);
-        shaderLightingPass.setVec3("lightColor", 1.0f, 1.0f, 1.0f); // 设置光源颜色为白色
-        renderQuad(); // 渲染屏幕四边形
+        if (lightField.Lights.size() > 1 && !options.staticLights)
+        {
+            // 动态光源随 deltaTime 推进 (基准测试/回放时 deltaTime 固定，结果可复现)
+            lightAnimationTime += deltaTime;
+            lightField.Update(lightAnimationTime);
+        }
+        if (lightingPath == LIGHTING_CLUSTERED)
+            clusteredLighting.Assign(lightField.Lights, view, projection, threadPool);
+        if (pointShadowsEnabled)
+        {
+            // 光源位置已更新，重新分配图集并按需重画各光源的阴影
+            movingCasters.clear();
+            movingCasters.push_back({ glm::vec3(dynamicCubeModel()[3]), dynamicCubeScale * 0.8660254f }); // 半对角线
+            gpuProfiler.BeginPass(passPointShadows);
+            pointShadows.Update(lightField.Lights, movingCasters, view, projection, SCR_HEIGHT, drawShadowCasters);
+            glBindFramebuffer(GL_FRAMEBUFFER, outputFBO);
+            gpuProfiler.EndPass(passPointShadows);
+        }
+
+        gpuProfiler.BeginPass(passLighting);
+        if (lightingPath == LIGHTING_TILED)
+        {
+            tiledLighting.UploadLights(lightField.Lights);
+            tiledLighting.Dispatch(gBuffer, view, projection, camera.Position, outputFBO);
+        }
+        else
+        {
+            shaderLightingPass.use();
+            gBuffer.BindTextures();
+            // G-buffer 可能大于窗口，只采样左下角实际渲染的子矩形
+            shaderLightingPass.setVec2("gBufferUVScale", gBuffer.UVScale());
+            // 上传光源数据: 只有四边形路径在 lighting_pass.fs 中遍历光源数组，其余路径只需要摄像机位置
+            lightBuffer.Upload(camera.Position, lightField.Lights, lightingPath == LIGHTING_QUAD ? lightField.Lights.size() : 0);
+            if (lightingPath == LIGHTING_CLUSTERED)
+                clusteredLighting.Bind(shaderLightingPass, view, gBuffer.Size);
+            if (gBufferLayout != GBUFFER_CLASSIC)
+                shaderLightingPass.setMat4("invViewProjection", glm::inverse(projection * view));
+            if (shadowsEnabled)
+                cascadedShadows.Bind();
+            if (pointShadowsEnabled)
+                pointShadows.Bind();
+            renderQuad(); // 渲染屏幕四边形 (LIGHT_VOLUMES 时只有环境光)
+            if (lightingPath == LIGHTING_VOLUMES)
+            {
+                // 模板阶段要用场景深度做测试，提前把 G-buffer 的深度复制到输出帧缓冲
+                blitGBufferDepth();
+                lightVolumes.Render(lightField.Lights, gBuffer, view, projection, camera.Position, NEAR_PLANE, FAR_PLANE);
+            }
+        }
+        gpuProfiler.EndPass(passLighting);
 
         // 2.5. 复制 G-buffer 的深度信息到默认帧缓冲
         // ----------------------------------------------------------------------------------
-        glBindFramebuffer(GL_READ_FRAMEBUFFER, gBuffer);
-        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0); // 写入到默认帧缓冲
-        glBlitFramebuffer(0, 0, SCR_WIDTH, SCR_HEIGHT, 0, 0, SCR_WIDTH, SCR_HEIGHT, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        gpuProfiler.BeginPass(passDepthBlit);
+        if (lightingPath != LIGHTING_VOLUMES) // 光源体积路径在光照阶段已经复制过
+            blitGBufferDepth();
+        gpuProfiler.EndPass(passDepthBlit);
 
         // 3. 渲染光源立方体 (保持原始逻辑)
         // -----------------------------------------------------------------
+        gpuProfiler.BeginPass(passLightBox);
         shaderLightBox.use();
         shaderLightBox.setMat4("projection", projection);
         shaderLightBox.setMat4("view", view);
@@ -283,47 +917,158 @@ int main()
         model = glm::translate(model, lightPos);
         model = glm::scale(model, glm::vec3(0.2f)); // 使立方体变小
         shaderLightBox.setMat4("model", model);
+        cubeMesh.SetPositionUniforms(shaderLightBox);
         glBindVertexArray(lightCubeVAO); // 使用光源立方体的 VAO
-        glDrawArrays(GL_TRIANGLES, 0, 36);
+        cubeMesh.Draw();
         glBindVertexArray(0);
+        gpuProfiler.EndPass(passLightBox);
+        gpuProfiler.EndFrame();
+
+        if (gpuStatsRequested)
+        {
+            gpuStatsRequested = false;
+            gpuProfiler.PrintSummary();
+            if (!options.gpuCsvPath.empty())
+                gpuProfiler.WriteCsv(options.gpuCsvPath);
+        }
+        // 交互模式下把滚动统计显示在窗口标题上 (每 0.5 秒刷新一次)
+        if (window && !benchmarkMode && glfwGetTime() - lastTitleUpdate > 0.5)
+        {
+            lastTitleUpdate = glfwGetTime();
+            std::string title = "Deferred Rendering | " + gpuProfiler.FormatStats();
+            glfwSetWindowTitle(window, title.c_str());
+        }
+
+        if (benchmarkMode)
+        {
+            // CPU 时间只统计命令提交；随后等待 GPU 完成，得到完整的帧时间
+            double cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+            if (window)
+            {
+                CPU_PROFILE_SCOPE("glfwSwapBuffers");
+                glfwSwapBuffers(window);
+            }
+            glFinish();
+            double frameMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+            frameTimer.EndFrame(cpuMs, frameMs, objectsDrawn, trianglesDrawn, lodInstancesDrawn > 0 ? instancedScene.Lod.FrameMeanError : 0.0);
+            ++frameIndex;
+            if (window)
+            {
+                {
+                    CPU_PROFILE_SCOPE("glfwPollEvents");
+                    glfwPollEvents();
+                }
+                if (glfwWindowShouldClose(window))
+                    break;
+            }
+        }
+        else
+        {
+            {
+                CPU_PROFILE_SCOPE("glfwSwapBuffers");
+                glfwSwapBuffers(window);
+            }
+            {
+                CPU_PROFILE_SCOPE("glfwPollEvents");
+                glfwPollEvents();
+            }
+        }
+
+        if (cpuTraceRequested)
+        {
+            cpuTraceRequested = false;
+            CPU_PROFILE_DUMP(options.cpuTracePath);
+        }
+    }
 
-        glfwSwapBuffers(window);
-        glfwPollEvents();
+    recorder.Close();
+
+    if (benchmarkMode)
+    {
+        frameTimer.Finish();
+        frameTimer.PrintSummary();
+        frameTimer.WriteCsv(options.csvPath);
+    }
+    gpuProfiler.Finish();
+    if (benchmarkMode)
+    {
+        gpuProfiler.PrintSummary();
+        tiledLighting.PrintSummary();
+        clusteredLighting.PrintSummary();
+        cascadedShadows.PrintSummary();
+        pointShadows.PrintSummary();
+        if (frustumCulling)
+            sceneBvh.PrintSummary();
+        softwareOcclusion.PrintSummary();
+        clusterQueries.PrintSummary("Instance cluster");
+        if (lightVolumes.UseQueries)
+            lightVolumes.Queries.PrintSummary("Light volume");
+        gpuCulling.PrintSummary();
+        instancedScene.Lod.PrintSummary();
+        renderQueue.PrintSummary();
+        if (lightingPath == LIGHTING_VOLUMES)
+            std::cout << "Light volumes (last frame): " << lightVolumes.StencilledLights << " stencilled, "
+                      << lightVolumes.ScissorOnlyLights << " scissor-only, " << lightVolumes.CulledLights << " culled" << std::endl;
     }
+    if (!options.gpuCsvPath.empty())
+        gpuProfiler.WriteCsv(options.gpuCsvPath);
+    CPU_PROFILE_DUMP(options.cpuTracePath);
 
     // 释放资源
     glDeleteVertexArrays(1, &cubeVAO);
     glDeleteVertexArrays(1, &lightCubeVAO);
-    glDeleteBuffers(1, &cubeVBO);
+    cubeMesh.Destroy();
     glDeleteTextures(1, &diffuseMap);
-    glDeleteFramebuffers(1, &gBuffer);
-    glDeleteTextures(1, &gPosition);
-    glDeleteTextures(1, &gNormal);
-    glDeleteTextures(1, &gAlbedoSpec);
-    glDeleteRenderbuffers(1, &rboDepth);
+    if (gBuffer.Reallocations > 1)
+        std::cout << "G-buffer reallocations: " << gBuffer.Reallocations << std::endl;
+    gBuffer.Destroy();
+    tiledLighting.Destroy();
+    clusteredLighting.Destroy();
+    lightVolumes.Destroy();
+    lightBuffer.Destroy();
+    cascadedShadows.Destroy();
+    pointShadows.Destroy();
+    instancedScene.Destroy();
+    rockLod.Destroy();
+    materialScene.Destroy();
+    smallRockMesh.Destroy();
+    if (smallRockVAO != 0)
+        glDeleteVertexArrays(1, &smallRockVAO);
+    gpuCulling.Destroy();
+    hiZPyramid.Destroy();
+    clusterQueries.Destroy();
      if (quadVAO != 0) {
         glDeleteVertexArrays(1, &quadVAO);
         glDeleteBuffers(1, &quadVBO);
     }
+    if (offscreen.FBO != 0)
+        offscreen.Destroy();
+    frameTimer.Destroy();
+    gpuProfiler.Destroy();
 
 
+#ifdef HEADLESS_EGL
+    headless.Destroy();
+#endif
     glfwTerminate();
     return 0;
 }
 
-// 输入处理函数 (保持不变)
+// 输入处理函数
 void processInput(GLFWwindow *window)
 {
+    CPU_PROFILE_SCOPE("processInput");
     if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
         glfwSetWindowShouldClose(window, true);
+    // 只记录按键状态，由 ApplyFrameInput 统一作用到摄像机 (便于录制/回放)
     if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
-        camera.ProcessKeyboard(FORWARD, deltaTime);
+        frameInput.Keys |= 1 << FORWARD;
     if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
-        camera.ProcessKeyboard(BACKWARD, deltaTime);
+        frameInput.Keys |= 1 << BACKWARD;
     if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
-        camera.ProcessKeyboard(LEFT, deltaTime);
+        frameInput.Keys |= 1 << LEFT;
     if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
-        camera.ProcessKeyboard(RIGHT, deltaTime);
+        frameInput.Keys |= 1 << RIGHT;
 }
 
 // 窗口大小调整回调 (更新 G-buffer)
@@ -333,18 +1078,11 @@ void framebuffer_size_callback(GLFWwindow* window, int width, int height)
     SCR_WIDTH = width;
     SCR_HEIGHT = height;
 
-    // 重新调整 G-buffer 纹理和深度缓冲的大小
-    glBindTexture(GL_TEXTURE_2D, gPosition);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGB, GL_FLOAT, NULL);
-    glBindTexture(GL_TEXTURE_2D, gNormal);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB16F, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGB, GL_FLOAT, NULL);
-    glBindTexture(GL_TEXTURE_2D, gAlbedoSpec);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, SCR_WIDTH, SCR_HEIGHT, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-    glBindRenderbuffer(GL_RENDERBUFFER, rboDepth);
-    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, SCR_WIDTH, SCR_HEIGHT);
+    // G-buffer 只在超出已分配尺寸时才重建，其余情况渲染到子矩形 (见 gbuffer.h)
+    gBuffer.Resize(width, height, glfwGetTime());
 }
 
-// 鼠标移动回调 (保持不变)
+// 鼠标移动回调 (偏移量累计到 frameInput)
 void mouse_callback(GLFWwindow* window, double xposIn, double yposIn)
 {
     float xpos = static_cast<float>(xposIn);
@@ -359,13 +1097,25 @@ void mouse_callback(GLFWwindow* window, double xposIn, double yposIn)
     float yoffset = lastY - ypos;
     lastX = xpos;
     lastY = ypos;
-    camera.ProcessMouseMovement(xoffset, yoffset);
+    frameInput.MouseDX += xoffset;
+    frameInput.MouseDY += yoffset;
 }
 
-// 鼠标滚轮回调 (保持不变)
+// 鼠标滚轮回调 (偏移量累计到 frameInput)
 void scroll_callback(GLFWwindow* window, double xoffset, double yoffset)
 {
-    camera.ProcessMouseScroll(static_cast<float>(yoffset));
+    frameInput.Scroll += static_cast<float>(yoffset);
+}
+
+// 键盘事件回调 (只处理按下瞬间触发一次的热键，持续按键仍在 processInput 中轮询)
+void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    if (action != GLFW_PRESS)
+        return;
+    if (key == GLFW_KEY_F2)
+        gpuStatsRequested = true;
+    if (key == GLFW_KEY_F3)
+        cpuTraceRequested = true;
 }
 
 // 加载纹理函数 (保持不变)
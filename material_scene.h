@@ -0,0 +1,94 @@
+#ifndef MATERIAL_SCENE_H
+#define MATERIAL_SCENE_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "instanced_scene.h"
+#include "stb_image.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// 多材质场景 (绘制排序的压力测试)
+// objectCount 个单独绘制的物体分布在实例化场景外侧的球壳格点上 (firstCell 跳过实例化场景占用的格点)，每个物体随机使用 MeshKinds 种网格之一
+// (由调用方提供，例如立方体和低模岩石) 和 materialCount 种材质之一。
+// 材质 = 着色器变体 (Variant，由调用方映射到几何阶段的着色器) + 一张由基础纹理按色相染色得到的纹理。
+class MaterialScene
+{
+public:
+    static const int MeshKinds = 2;
+    static const int ShaderVariants = 2; // 奇数材质使用第二个变体
+
+    struct Object
+    {
+        glm::mat4 Model;
+        int MeshKind;
+        int Material;
+    };
+
+    struct Material
+    {
+        unsigned int Texture;
+        int Variant;
+    };
+
+    std::vector<Object> Objects;
+    std::vector<Material> Materials;
+
+    bool Create(const char* texturePath, int objectCount, int materialCount, int firstCell, unsigned int seed = 13)
+    {
+        materialCount = std::max(materialCount, 1);
+        int width, height, channels;
+        unsigned char* pixels = stbi_load(texturePath, &width, &height, &channels, 3);
+        if (!pixels)
+        {
+            std::cout << "Material scene: failed to load " << texturePath << std::endl;
+            return false;
+        }
+        // 色相均匀分布在色环上，保留一部分原色
+        std::vector<unsigned char> tinted(static_cast<size_t>(width) * height * 3);
+        for (int material = 0; material < materialCount; ++material)
+        {
+            float hue = static_cast<float>(material) / materialCount * 6.2831853f;
+            glm::vec3 tint = 0.4f + 0.6f * (0.5f + 0.5f * glm::vec3(std::cos(hue), std::cos(hue - 2.0943951f), std::cos(hue + 2.0943951f)));
+            for (size_t i = 0; i < tinted.size(); ++i)
+                tinted[i] = static_cast<unsigned char>(std::min(255.0f, pixels[i] * tint[static_cast<int>(i % 3)]));
+            unsigned int texture;
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, tinted.data());
+            glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            glGenerateMipmap(GL_TEXTURE_2D);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            Materials.push_back({ texture, material % ShaderVariants });
+        }
+        glBindTexture(GL_TEXTURE_2D, 0);
+        stbi_image_free(pixels);
+
+        std::vector<glm::mat4> transforms = InstancedScene::GenerateShellTransforms(objectCount, seed, firstCell);
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int> meshKind(0, MeshKinds - 1);
+        std::uniform_int_distribution<int> material(0, materialCount - 1);
+        for (const glm::mat4& model : transforms)
+            Objects.push_back({ model, meshKind(rng), material(rng) });
+        return true;
+    }
+
+    void Destroy()
+    {
+        for (const Material& material : Materials)
+            glDeleteTextures(1, &material.Texture);
+        Materials.clear();
+        Objects.clear();
+    }
+};
+
+#endif
@@ -0,0 +1,444 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "shader_m.h"
+#include "vertex_format.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 后变换顶点缓存的统计 (FIFO 模拟)
+// ACMR: 平均每个三角形的缓存未命中数 (非索引网格为 3，理想的规则网格接近 0.5)
+// ATVR: 未命中数 / 顶点数 (每个顶点只变换一次时为 1)
+struct VertexCacheStats
+{
+    float Acmr = 0.0f;
+    float Atvr = 0.0f;
+};
+
+// 索引网格的构建流程:
+// 1. 焊接: 所有属性逐位相同的顶点合并为一个，生成索引缓冲；焊接后出现重复顶点的退化三角形被去掉
+// 2. 顶点缓存优化: Tipsify (Sander et al. 2007)，围绕扇形中心顶点输出三角形，按缓存中剩余寿命选择下一个中心
+// 3. overdraw 优化: Tipsify 在死胡同处跳转时切分出的簇，按簇的朝向 (法线·(簇中心 - 网格中心)) 从外向内排序，
+//    外侧面先画，后画的三角形更容易被深度测试提前剔除
+// 4. 顶点读取优化: 顶点按在索引缓冲中首次出现的顺序重排，顶点读取连续
+// 顶点是交错的 float 数组，前 3 个分量必须是位置。顶点数不超过 65536 时上传 16 位索引。
+// 上传时按顶点属性描述表 (vertex_format.h) 编码，位置量化所需的 scale/bias 取自网格的包围盒。
+class Mesh
+{
+public:
+    static const int CacheSize = 16; // 优化和统计使用的缓存大小 (FIFO 项数)
+
+    int FloatsPerVertex = 0;
+    std::vector<float> Vertices;
+    std::vector<uint32_t> Indices;
+    int InputVertexCount = 0;    // 焊接前的顶点数
+    VertexCacheStats InputStats; // 焊接后、优化前的索引顺序
+    VertexCacheStats Stats;      // 优化后
+
+    unsigned int VBO = 0, EBO = 0;
+    GLenum IndexType = GL_UNSIGNED_INT;
+    int IndexCount = 0;
+    std::vector<VertexAttribute> Attributes; // 上传时使用的顶点格式
+    glm::vec3 PositionScale = glm::vec3(1.0f); // 位置反量化: position = q * PositionScale + PositionBias
+    glm::vec3 PositionBias = glm::vec3(0.0f);
+
+    int VertexCount() const { return static_cast<int>(Vertices.size()) / FloatsPerVertex; }
+    int TriangleCount() const { return static_cast<int>(Indices.size()) / 3; }
+
+    // 从非索引的三角形列表构建 (每 3 个顶点一个三角形)
+    void Build(const float* vertices, int vertexCount, int floatsPerVertex)
+    {
+        std::vector<uint32_t> indices(vertexCount);
+        for (int i = 0; i < vertexCount; ++i)
+            indices[i] = static_cast<uint32_t>(i);
+        Build(vertices, vertexCount, floatsPerVertex, indices);
+    }
+
+    // 从已有的索引网格构建 (仍然会焊接重复的顶点)
+    void Build(const float* vertices, int vertexCount, int floatsPerVertex, const std::vector<uint32_t>& indices)
+    {
+        FloatsPerVertex = floatsPerVertex;
+        InputVertexCount = vertexCount;
+        weld(vertices, vertexCount, indices);
+        InputStats = AnalyzeVertexCache(Indices, VertexCount(), CacheSize);
+        optimizeVertexCache();
+        optimizeVertexFetch();
+        Stats = AnalyzeVertexCache(Indices, VertexCount(), CacheSize);
+    }
+
+    // 按描述表编码顶点并创建顶点/索引缓冲。各使用者在自己的 VAO 中调用 SetupAttributes
+    void Upload(const std::vector<VertexAttribute>& attributes)
+    {
+        Attributes = attributes;
+        IndexCount = static_cast<int>(Indices.size());
+        computePositionRange();
+        std::vector<unsigned char> encoded = EncodeVertices(Attributes, Vertices.data(), VertexCount(), FloatsPerVertex,
+                                                            PositionScale, PositionBias);
+        glGenBuffers(1, &VBO);
+        glGenBuffers(1, &EBO);
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, encoded.size(), encoded.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        if (VertexCount() <= 65536)
+        {
+            std::vector<uint16_t> shortIndices(Indices.begin(), Indices.end());
+            IndexType = GL_UNSIGNED_SHORT;
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, shortIndices.size() * sizeof(uint16_t), shortIndices.data(), GL_STATIC_DRAW);
+        }
+        else
+        {
+            IndexType = GL_UNSIGNED_INT;
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, Indices.size() * sizeof(uint32_t), Indices.data(), GL_STATIC_DRAW);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // 在当前绑定的 VAO 中绑定顶点/索引缓冲，并按描述表设置全部属性指针
+    void SetupAttributes() const
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+        SetupVertexAttributes(Attributes);
+    }
+
+    bool QuantizedPositions() const
+    {
+        for (const VertexAttribute& attribute : Attributes)
+            if (attribute.Location == 0 && attribute.Encoding == VERTEX_SNORM16_SCALE_BIAS)
+                return true;
+        return false;
+    }
+
+    // 设置位置反量化的 uniform (着色器以 GetVertexFormatDefines 生成的定义编译)，未量化时什么也不做
+    void SetPositionUniforms(const Shader& shader) const
+    {
+        if (!QuantizedPositions())
+            return;
+        shader.setVec3("positionScale", PositionScale);
+        shader.setVec3("positionBias", PositionBias);
+    }
+
+    int BytesPerVertex() const { return VertexStride(Attributes); }
+
+    // 使用当前绑定的 VAO 绘制
+    void Draw() const
+    {
+        glDrawElements(GL_TRIANGLES, IndexCount, IndexType, 0);
+    }
+
+    void DrawInstanced(int instances) const
+    {
+        glDrawElementsInstanced(GL_TRIANGLES, IndexCount, IndexType, 0, instances);
+    }
+
+    void Destroy()
+    {
+        glDeleteBuffers(1, &VBO);
+        glDeleteBuffers(1, &EBO);
+        VBO = EBO = 0;
+        IndexCount = 0;
+        Attributes.clear();
+    }
+
+    void PrintSummary(const std::string& name) const
+    {
+        // 只对这一行设置定点格式，之后恢复 cout 原来的格式和精度
+        std::ios_base::fmtflags flags = std::cout.flags();
+        std::streamsize precision = std::cout.precision();
+        std::cout << std::fixed << std::setprecision(3)
+                  << "Mesh " << name << ": " << InputVertexCount << " -> " << VertexCount() << " vertices, "
+                  << TriangleCount() << " triangles, " << BytesPerVertex() << " B/vertex, "
+                  << (IndexType == GL_UNSIGNED_SHORT ? 16 : 32) << "-bit indices, "
+                  << "ACMR " << InputStats.Acmr << " -> " << Stats.Acmr << ", ATVR " << InputStats.Atvr << " -> " << Stats.Atvr << std::endl;
+        std::cout.flags(flags);
+        std::cout.precision(precision);
+    }
+
+    // 用 FIFO 缓存模拟后变换缓存，统计 ACMR/ATVR
+    static VertexCacheStats AnalyzeVertexCache(const std::vector<uint32_t>& indices, int vertexCount, int cacheSize)
+    {
+        VertexCacheStats stats;
+        if (indices.empty() || vertexCount == 0)
+            return stats;
+        // 顶点进入 FIFO 时记录时间戳，时间戳落后超过 cacheSize 即已被挤出
+        std::vector<long long> insertedAt(vertexCount, -1);
+        long long misses = 0;
+        for (uint32_t v : indices)
+        {
+            if (insertedAt[v] < 0 || misses - insertedAt[v] >= cacheSize)
+            {
+                insertedAt[v] = misses;
+                ++misses;
+            }
+        }
+        stats.Acmr = static_cast<float>(misses) / (indices.size() / 3);
+        stats.Atvr = static_cast<float>(misses) / vertexCount;
+        return stats;
+    }
+
+private:
+    std::vector<int> clusterStarts; // Tipsify 输出中各簇的首个三角形
+
+    // 量化范围: bias 为包围盒中心，scale 为各轴半长，位置映射到 [-1, 1]
+    void computePositionRange()
+    {
+        PositionScale = glm::vec3(1.0f);
+        PositionBias = glm::vec3(0.0f);
+        if (!QuantizedPositions() || VertexCount() == 0)
+            return;
+        glm::vec3 lo(position(0)), hi(position(0));
+        for (int v = 1; v < VertexCount(); ++v)
+        {
+            lo = glm::min(lo, position(v));
+            hi = glm::max(hi, position(v));
+        }
+        PositionBias = (lo + hi) * 0.5f;
+        PositionScale = glm::max((hi - lo) * 0.5f, glm::vec3(1e-6f));
+    }
+
+    static uint64_t hashVertex(const float* v, int floats)
+    {
+        uint64_t hash = 1469598103934665603ull; // FNV-1a
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(v);
+        for (size_t i = 0; i < floats * sizeof(float); ++i)
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        return hash;
+    }
+
+    // 开放寻址哈希表按位比较，重复顶点映射到第一次出现的位置
+    void weld(const float* vertices, int vertexCount, const std::vector<uint32_t>& indices)
+    {
+        size_t tableSize = 1;
+        while (tableSize < static_cast<size_t>(vertexCount) * 2)
+            tableSize *= 2;
+        std::vector<int> table(tableSize, -1);
+        std::vector<uint32_t> remap(vertexCount);
+        Vertices.clear();
+        Vertices.reserve(static_cast<size_t>(vertexCount) * FloatsPerVertex);
+        size_t stride = FloatsPerVertex;
+        std::vector<float> canonical(stride);
+        for (int i = 0; i < vertexCount; ++i)
+        {
+            // -0 与 +0 数值相等但位模式不同，先统一为 +0 再比较
+            for (size_t k = 0; k < stride; ++k)
+                canonical[k] = vertices[i * stride + k] + 0.0f;
+            const float* v = canonical.data();
+            size_t slot = hashVertex(v, FloatsPerVertex) & (tableSize - 1);
+            while (table[slot] >= 0 && std::memcmp(&Vertices[table[slot] * stride], v, stride * sizeof(float)) != 0)
+                slot = (slot + 1) & (tableSize - 1);
+            if (table[slot] < 0)
+            {
+                table[slot] = static_cast<int>(Vertices.size() / stride);
+                Vertices.insert(Vertices.end(), v, v + stride);
+            }
+            remap[i] = static_cast<uint32_t>(table[slot]);
+        }
+        Indices.clear();
+        Indices.reserve(indices.size());
+        for (size_t t = 0; t + 2 < indices.size(); t += 3)
+        {
+            uint32_t a = remap[indices[t]], b = remap[indices[t + 1]], c = remap[indices[t + 2]];
+            if (a != b && b != c && c != a)
+                Indices.insert(Indices.end(), { a, b, c });
+        }
+    }
+
+    // Tipsify 顶点缓存优化，随后按簇做 overdraw 排序
+    void optimizeVertexCache()
+    {
+        int vertexCount = VertexCount();
+        int triangleCount = TriangleCount();
+        if (triangleCount == 0)
+            return;
+
+        // 顶点 -> 相邻三角形 (CSR 布局)
+        std::vector<int> adjacencyStart(vertexCount + 1, 0);
+        for (uint32_t v : Indices)
+            ++adjacencyStart[v + 1];
+        for (int v = 0; v < vertexCount; ++v)
+            adjacencyStart[v + 1] += adjacencyStart[v];
+        std::vector<int> adjacency(Indices.size());
+        std::vector<int> fill(adjacencyStart.begin(), adjacencyStart.end() - 1);
+        for (int t = 0; t < triangleCount; ++t)
+            for (int k = 0; k < 3; ++k)
+                adjacency[fill[Indices[t * 3 + k]]++] = t;
+
+        std::vector<int> liveTriangles(vertexCount);
+        for (int v = 0; v < vertexCount; ++v)
+            liveTriangles[v] = adjacencyStart[v + 1] - adjacencyStart[v];
+        std::vector<int> cacheTime(vertexCount, 0);
+        std::vector<char> emitted(triangleCount, 0);
+        std::vector<int> deadEnd; // 最近输出的顶点栈
+        std::vector<int> candidates;
+        std::vector<uint32_t> output;
+        output.reserve(Indices.size());
+        clusterStarts.assign(1, 0);
+
+        int time = CacheSize + 1;
+        int cursor = 1;
+        int fan = 0;
+        while (fan >= 0)
+        {
+            candidates.clear();
+            for (int a = adjacencyStart[fan]; a < adjacencyStart[fan + 1]; ++a)
+            {
+                int t = adjacency[a];
+                if (emitted[t])
+                    continue;
+                for (int k = 0; k < 3; ++k)
+                {
+                    int v = Indices[t * 3 + k];
+                    output.push_back(v);
+                    deadEnd.push_back(v);
+                    candidates.push_back(v);
+                    --liveTriangles[v];
+                    if (time - cacheTime[v] > CacheSize)
+                        cacheTime[v] = time++;
+                }
+                emitted[t] = 1;
+            }
+
+            // 下一个扇形中心: 仍有未输出三角形、且处理完后仍在缓存中的候选里最老的一个
+            int next = -1, bestPriority = -1;
+            for (int v : candidates)
+            {
+                if (liveTriangles[v] <= 0)
+                    continue;
+                int priority = 0;
+                if (time - cacheTime[v] + 2 * liveTriangles[v] <= CacheSize)
+                    priority = time - cacheTime[v];
+                if (priority > bestPriority)
+                {
+                    bestPriority = priority;
+                    next = v;
+                }
+            }
+            if (next < 0)
+            {
+                // 死胡同: 先回溯最近输出的顶点，再按顺序扫描；这里是簇的硬边界
+                next = skipDeadEnd(liveTriangles, deadEnd, cursor);
+                if (next >= 0)
+                    clusterStarts.push_back(static_cast<int>(output.size() / 3));
+            }
+            fan = next;
+        }
+        Indices.swap(output);
+        optimizeOverdraw();
+    }
+
+    int skipDeadEnd(const std::vector<int>& liveTriangles, std::vector<int>& deadEnd, int& cursor) const
+    {
+        while (!deadEnd.empty())
+        {
+            int v = deadEnd.back();
+            deadEnd.pop_back();
+            if (liveTriangles[v] > 0)
+                return v;
+        }
+        for (; cursor < static_cast<int>(liveTriangles.size()); ++cursor)
+            if (liveTriangles[cursor] > 0)
+                return cursor++;
+        return -1;
+    }
+
+    glm::vec3 position(uint32_t vertex) const
+    {
+        const float* p = &Vertices[static_cast<size_t>(vertex) * FloatsPerVertex];
+        return glm::vec3(p[0], p[1], p[2]);
+    }
+
+    // 簇按朝外程度从大到小排序，簇内部保持 Tipsify 的顺序 (只有簇边界处的缓存命中受影响)
+    void optimizeOverdraw()
+    {
+        int triangleCount = TriangleCount();
+        int clusterCount = static_cast<int>(clusterStarts.size());
+        if (clusterCount <= 1)
+            return;
+
+        // 网格中心: 按面积加权的三角形重心
+        auto triangleInfo = [&](int t, glm::vec3& centroid, glm::vec3& areaNormal) {
+            glm::vec3 a = position(Indices[t * 3]), b = position(Indices[t * 3 + 1]), c = position(Indices[t * 3 + 2]);
+            centroid = (a + b + c) / 3.0f;
+            areaNormal = glm::cross(b - a, c - a);
+        };
+        glm::vec3 meshCenter(0.0f);
+        float meshArea = 0.0f;
+        for (int t = 0; t < triangleCount; ++t)
+        {
+            glm::vec3 centroid, areaNormal;
+            triangleInfo(t, centroid, areaNormal);
+            float area = glm::length(areaNormal);
+            meshCenter += centroid * area;
+            meshArea += area;
+        }
+        if (meshArea > 0.0f)
+            meshCenter /= meshArea;
+
+        std::vector<float> sortKey(clusterCount);
+        for (int cluster = 0; cluster < clusterCount; ++cluster)
+        {
+            int end = cluster + 1 < clusterCount ? clusterStarts[cluster + 1] : triangleCount;
+            glm::vec3 center(0.0f), normal(0.0f);
+            float area = 0.0f;
+            for (int t = clusterStarts[cluster]; t < end; ++t)
+            {
+                glm::vec3 centroid, areaNormal;
+                triangleInfo(t, centroid, areaNormal);
+                float triangleArea = glm::length(areaNormal);
+                center += centroid * triangleArea;
+                normal += areaNormal;
+                area += triangleArea;
+            }
+            if (area > 0.0f)
+                center /= area;
+            float normalLength = glm::length(normal);
+            sortKey[cluster] = normalLength > 0.0f ? glm::dot(center - meshCenter, normal / normalLength) : 0.0f;
+        }
+
+        std::vector<int> order(clusterCount);
+        for (int i = 0; i < clusterCount; ++i)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return sortKey[a] > sortKey[b]; });
+
+        std::vector<uint32_t> sorted;
+        sorted.reserve(Indices.size());
+        for (int cluster : order)
+        {
+            int end = cluster + 1 < clusterCount ? clusterStarts[cluster + 1] : triangleCount;
+            sorted.insert(sorted.end(), Indices.begin() + clusterStarts[cluster] * 3, Indices.begin() + end * 3);
+        }
+        Indices.swap(sorted);
+    }
+
+    // 顶点按首次使用的顺序重排，未被引用的顶点丢弃
+    void optimizeVertexFetch()
+    {
+        int vertexCount = VertexCount();
+        std::vector<int> remap(vertexCount, -1);
+        std::vector<float> reordered;
+        reordered.reserve(Vertices.size());
+        int next = 0;
+        for (uint32_t& index : Indices)
+        {
+            if (remap[index] < 0)
+            {
+                remap[index] = next++;
+                reordered.insert(reordered.end(), Vertices.begin() + index * FloatsPerVertex,
+                                 Vertices.begin() + (index + 1) * FloatsPerVertex);
+            }
+            index = static_cast<uint32_t>(remap[index]);
+        }
+        Vertices.swap(reordered);
+    }
+};
+
+#endif
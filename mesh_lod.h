@@ -0,0 +1,504 @@
+#ifndef MESH_LOD_H
+#define MESH_LOD_H
+
+#include <glm/glm.hpp>
+
+#include "mesh.h"
+#include "vertex_format.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// 程序化生成的高面数岩石: 细分 subdivisions 次的二十面体球，半径沿几组随机方向的正弦波起伏 (结果只取决于 seed)。
+// 法线为相邻三角形法线的面积加权平均，纹理坐标是位置的平面投影 (没有接缝，每个位置只有一个顶点，简化时不会撕开)。
+// 输出交错的位置/法线/纹理坐标 (每个顶点 8 个 float) 和索引，网格包在 [-0.5, 0.5] 的立方体内。
+inline void GenerateRockMesh(int subdivisions, unsigned int seed, std::vector<float>& vertices, std::vector<uint32_t>& indices)
+{
+    const float t = (1.0f + std::sqrt(5.0f)) * 0.5f;
+    std::vector<glm::vec3> positions = {
+        { -1.0f, t, 0.0f }, { 1.0f, t, 0.0f }, { -1.0f, -t, 0.0f }, { 1.0f, -t, 0.0f },
+        { 0.0f, -1.0f, t }, { 0.0f, 1.0f, t }, { 0.0f, -1.0f, -t }, { 0.0f, 1.0f, -t },
+        { t, 0.0f, -1.0f }, { t, 0.0f, 1.0f }, { -t, 0.0f, -1.0f }, { -t, 0.0f, 1.0f }
+    };
+    for (glm::vec3& p : positions)
+        p = glm::normalize(p);
+    indices = { 0, 11, 5,  0, 5, 1,   0, 1, 7,   0, 7, 10,  0, 10, 11,
+                1, 5, 9,   5, 11, 4,  11, 10, 2, 10, 7, 6,  7, 1, 8,
+                3, 9, 4,   3, 4, 2,   3, 2, 6,   3, 6, 8,   3, 8, 9,
+                4, 9, 5,   2, 4, 11,  6, 2, 10,  8, 6, 7,   9, 8, 1 };
+
+    // 每条边的中点只生成一次，相邻三角形共用
+    for (int level = 0; level < subdivisions; ++level)
+    {
+        std::unordered_map<uint64_t, uint32_t> midpoints;
+        auto midpoint = [&](uint32_t a, uint32_t b) {
+            uint64_t key = (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+            auto found = midpoints.find(key);
+            if (found != midpoints.end())
+                return found->second;
+            uint32_t index = static_cast<uint32_t>(positions.size());
+            positions.push_back(glm::normalize(positions[a] + positions[b]));
+            midpoints.emplace(key, index);
+            return index;
+        };
+        std::vector<uint32_t> subdivided;
+        subdivided.reserve(indices.size() * 4);
+        for (size_t i = 0; i + 2 < indices.size(); i += 3)
+        {
+            uint32_t a = indices[i], b = indices[i + 1], c = indices[i + 2];
+            uint32_t ab = midpoint(a, b), bc = midpoint(b, c), ca = midpoint(c, a);
+            subdivided.insert(subdivided.end(), { a, ab, ca, b, bc, ab, c, ca, bc, ab, bc, ca });
+        }
+        indices.swap(subdivided);
+    }
+    // 统一为从外侧看逆时针
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        glm::vec3 a = positions[indices[i]], b = positions[indices[i + 1]], c = positions[indices[i + 2]];
+        if (glm::dot(glm::cross(b - a, c - a), a + b + c) < 0.0f)
+            std::swap(indices[i + 1], indices[i + 2]);
+    }
+
+    // 径向起伏: 振幅逐组减小、频率逐组升高，最大半径 0.38 + 0.045 * (1 + 0.6 + 0.36 + ...) < 0.5
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    struct Wave
+    {
+        glm::vec3 Direction;
+        float Frequency, Phase, Amplitude;
+    };
+    std::vector<Wave> waves;
+    float amplitude = 0.045f, frequency = 3.0f;
+    for (int i = 0; i < 6; ++i)
+    {
+        glm::vec3 direction = glm::normalize(glm::vec3(unit(rng), unit(rng), unit(rng)) - 0.5f + 1e-3f);
+        waves.push_back({ direction, frequency, unit(rng) * 6.2831853f, amplitude });
+        amplitude *= 0.6f;
+        frequency *= 1.8f;
+    }
+    for (glm::vec3& p : positions)
+    {
+        float radius = 0.38f;
+        for (const Wave& wave : waves)
+            radius += wave.Amplitude * std::sin(glm::dot(wave.Direction, p) * wave.Frequency + wave.Phase);
+        p *= radius;
+    }
+
+    std::vector<glm::vec3> normals(positions.size(), glm::vec3(0.0f));
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        glm::vec3 a = positions[indices[i]], b = positions[indices[i + 1]], c = positions[indices[i + 2]];
+        glm::vec3 areaNormal = glm::cross(b - a, c - a);
+        for (int k = 0; k < 3; ++k)
+            normals[indices[i + k]] += areaNormal;
+    }
+    vertices.clear();
+    vertices.reserve(positions.size() * 8);
+    for (size_t v = 0; v < positions.size(); ++v)
+    {
+        glm::vec3 p = positions[v], n = glm::normalize(normals[v]);
+        glm::vec2 uv = glm::vec2(p.x + 0.5f * p.z, p.y - 0.5f * p.z) * 2.0f;
+        vertices.insert(vertices.end(), { p.x, p.y, p.z, n.x, n.y, n.z, uv.x, uv.y });
+    }
+}
+
+// 二次误差度量 (Garland & Heckbert 1997) 的边折叠简化
+// - 每个顶点累积相邻三角形所在平面的二次型，误差为到这些平面距离平方的面积加权平均
+// - 只折叠到已有的端点上 (half-edge collapse)，简化结果仍然引用原来的顶点，属性不需要插值
+// - 候选折叠放在按误差排序的最小堆里，端点被修改过的旧候选出堆时按版本号丢弃
+// - 会翻转相邻三角形或破坏流形 (两端点的公共邻居多于这条边对面的顶点) 的折叠被拒绝，
+//   边界边和非流形边的端点锁定不动
+class QuadricSimplifier
+{
+public:
+    // targets: 从大到小的三角形数目标，每达到一个目标记录一份索引 (不能继续简化时提前结束)
+    // errors: 对应每份索引，到当时为止折叠误差最大值的平方根 (物体空间的均方根距离)
+    void Simplify(const std::vector<glm::vec3>& vertexPositions, const std::vector<uint32_t>& indices,
+                  const std::vector<int>& targets, std::vector<std::vector<uint32_t>>& levels, std::vector<float>& errors)
+    {
+        setup(vertexPositions, indices);
+        levels.clear();
+        errors.clear();
+        double maxCost = 0.0;
+        for (int target : targets)
+        {
+            while (liveTriangles > target && !heap.empty())
+            {
+                Collapse collapse = heap.top();
+                heap.pop();
+                if (removed[collapse.From] || removed[collapse.To] || version[collapse.From] != collapse.FromVersion
+                    || version[collapse.To] != collapse.ToVersion || !canCollapse(collapse.From, collapse.To))
+                    continue;
+                apply(collapse.From, collapse.To);
+                maxCost = std::max(maxCost, collapse.Cost);
+            }
+            size_t previous = levels.empty() ? indices.size() / 3 : levels.back().size() / 3;
+            if (static_cast<size_t>(liveTriangles) >= previous)
+                break;
+            levels.emplace_back();
+            for (size_t t = 0; t < triangleAlive.size(); ++t)
+                if (triangleAlive[t])
+                    levels.back().insert(levels.back().end(), triangles.begin() + t * 3, triangles.begin() + t * 3 + 3);
+            errors.push_back(static_cast<float>(std::sqrt(maxCost)));
+        }
+    }
+
+private:
+    // 对称 4x4 矩阵的上三角 (aa ab ac ad bb bc bd cc cd dd)，按三角形面积加权；
+    // Evaluate 除以总权重，得到到各平面距离平方的加权平均，与合并了多少个顶点无关
+    struct Quadric
+    {
+        double A[10] = {};
+        double Weight = 0.0;
+
+        void AddPlane(const glm::dvec3& n, double d, double weight)
+        {
+            double plane[4] = { n.x, n.y, n.z, d };
+            int k = 0;
+            for (int i = 0; i < 4; ++i)
+                for (int j = i; j < 4; ++j)
+                    A[k++] += plane[i] * plane[j] * weight;
+            Weight += weight;
+        }
+        void operator+=(const Quadric& other)
+        {
+            for (int k = 0; k < 10; ++k)
+                A[k] += other.A[k];
+            Weight += other.Weight;
+        }
+        double Evaluate(const glm::vec3& p) const
+        {
+            double x = p.x, y = p.y, z = p.z;
+            double error = A[0] * x * x + 2.0 * A[1] * x * y + 2.0 * A[2] * x * z + 2.0 * A[3] * x
+                         + A[4] * y * y + 2.0 * A[5] * y * z + 2.0 * A[6] * y
+                         + A[7] * z * z + 2.0 * A[8] * z + A[9];
+            return Weight > 0.0 ? std::max(error, 0.0) / Weight : 0.0;
+        }
+    };
+
+    struct Collapse
+    {
+        double Cost;
+        uint32_t From, To; // From 并入 To
+        int FromVersion, ToVersion;
+        bool operator>(const Collapse& other) const { return Cost > other.Cost; }
+    };
+
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t> triangles;
+    std::vector<char> triangleAlive;
+    std::vector<std::vector<int>> vertexTriangles; // 顶点 -> 引用它的三角形 (可能含已删除的，使用时检查)
+    std::vector<Quadric> quadrics;
+    std::vector<char> removed, locked;
+    std::vector<int> version; // 顶点的二次型每次变化加一
+    std::priority_queue<Collapse, std::vector<Collapse>, std::greater<Collapse>> heap;
+    int liveTriangles = 0;
+    std::vector<uint32_t> opposite, fromNeighbors, toNeighbors;
+
+    void setup(const std::vector<glm::vec3>& vertexPositions, const std::vector<uint32_t>& indices)
+    {
+        positions = vertexPositions;
+        triangles = indices;
+        size_t vertexCount = positions.size();
+        int triangleCount = static_cast<int>(triangles.size() / 3);
+        triangleAlive.assign(triangleCount, 1);
+        liveTriangles = triangleCount;
+        vertexTriangles.assign(vertexCount, std::vector<int>());
+        quadrics.assign(vertexCount, Quadric());
+        removed.assign(vertexCount, 0);
+        locked.assign(vertexCount, 0);
+        version.assign(vertexCount, 0);
+        heap = {};
+
+        std::unordered_map<uint64_t, int> edgeUses;
+        for (int t = 0; t < triangleCount; ++t)
+        {
+            glm::vec3 a = positions[triangles[t * 3]], b = positions[triangles[t * 3 + 1]], c = positions[triangles[t * 3 + 2]];
+            glm::dvec3 normal = glm::cross(glm::dvec3(b - a), glm::dvec3(c - a));
+            double length = glm::length(normal);
+            for (int k = 0; k < 3; ++k)
+            {
+                uint32_t v = triangles[t * 3 + k];
+                vertexTriangles[v].push_back(t);
+                if (length > 0.0)
+                    quadrics[v].AddPlane(normal / length, -glm::dot(normal / length, glm::dvec3(a)), length * 0.5);
+                ++edgeUses[edgeKey(v, triangles[t * 3 + (k + 1) % 3])];
+            }
+        }
+        for (const auto& edge : edgeUses)
+            if (edge.second != 2)
+            {
+                locked[edge.first >> 32] = 1;
+                locked[edge.first & 0xFFFFFFFFu] = 1;
+            }
+        for (const auto& edge : edgeUses)
+            pushEdge(static_cast<uint32_t>(edge.first >> 32), static_cast<uint32_t>(edge.first & 0xFFFFFFFFu));
+    }
+
+    static uint64_t edgeKey(uint32_t a, uint32_t b)
+    {
+        return (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+    }
+
+    bool contains(int t, uint32_t v) const
+    {
+        return triangles[t * 3] == v || triangles[t * 3 + 1] == v || triangles[t * 3 + 2] == v;
+    }
+
+    // 两个方向的折叠都作为候选 (误差较小的方向可能因为翻转被拒绝)
+    void pushEdge(uint32_t a, uint32_t b)
+    {
+        Quadric sum = quadrics[a];
+        sum += quadrics[b];
+        if (!locked[a])
+            heap.push({ sum.Evaluate(positions[b]), a, b, version[a], version[b] });
+        if (!locked[b])
+            heap.push({ sum.Evaluate(positions[a]), b, a, version[b], version[a] });
+    }
+
+    void collectNeighbors(uint32_t v, std::vector<uint32_t>& neighbors) const
+    {
+        neighbors.clear();
+        for (int t : vertexTriangles[v])
+            if (triangleAlive[t])
+                for (int k = 0; k < 3; ++k)
+                    if (triangles[t * 3 + k] != v)
+                        neighbors.push_back(triangles[t * 3 + k]);
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    }
+
+    bool canCollapse(uint32_t from, uint32_t to)
+    {
+        // 这条边对面的顶点 (共享这条边的三角形的第三个顶点)
+        opposite.clear();
+        for (int t : vertexTriangles[from])
+            if (triangleAlive[t] && contains(t, to))
+                for (int k = 0; k < 3; ++k)
+                    if (triangles[t * 3 + k] != from && triangles[t * 3 + k] != to)
+                        opposite.push_back(triangles[t * 3 + k]);
+        if (opposite.empty())
+            return false; // 边已经不存在了
+        std::sort(opposite.begin(), opposite.end());
+        opposite.erase(std::unique(opposite.begin(), opposite.end()), opposite.end());
+
+        // link condition: 公共邻居只能是对面的顶点
+        collectNeighbors(from, fromNeighbors);
+        collectNeighbors(to, toNeighbors);
+        size_t common = 0;
+        for (size_t i = 0, j = 0; i < fromNeighbors.size() && j < toNeighbors.size();)
+        {
+            if (fromNeighbors[i] < toNeighbors[j])
+                ++i;
+            else if (fromNeighbors[i] > toNeighbors[j])
+                ++j;
+            else
+            {
+                ++common;
+                ++i;
+                ++j;
+            }
+        }
+        if (common != opposite.size())
+            return false;
+
+        // 保留下来的三角形不能翻转或退化
+        for (int t : vertexTriangles[from])
+        {
+            if (!triangleAlive[t] || contains(t, to))
+                continue;
+            glm::vec3 corners[3], moved[3];
+            for (int k = 0; k < 3; ++k)
+            {
+                corners[k] = positions[triangles[t * 3 + k]];
+                moved[k] = triangles[t * 3 + k] == from ? positions[to] : corners[k];
+            }
+            glm::vec3 before = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+            glm::vec3 after = glm::cross(moved[1] - moved[0], moved[2] - moved[0]);
+            float afterLength = glm::length(after);
+            if (afterLength <= 1e-12f || glm::dot(before, after) <= 0.0f)
+                return false;
+        }
+        return true;
+    }
+
+    void apply(uint32_t from, uint32_t to)
+    {
+        for (int t : vertexTriangles[from])
+        {
+            if (!triangleAlive[t])
+                continue;
+            if (contains(t, to))
+            {
+                triangleAlive[t] = 0;
+                --liveTriangles;
+                continue;
+            }
+            for (int k = 0; k < 3; ++k)
+                if (triangles[t * 3 + k] == from)
+                    triangles[t * 3 + k] = to;
+            vertexTriangles[to].push_back(t);
+        }
+        vertexTriangles[from].clear();
+        removed[from] = 1;
+        quadrics[to] += quadrics[from];
+        ++version[to];
+        auto& adjacent = vertexTriangles[to];
+        adjacent.erase(std::remove_if(adjacent.begin(), adjacent.end(), [&](int t) { return !triangleAlive[t]; }), adjacent.end());
+
+        // 以 to 为端点的边误差都变了，重新入堆
+        collectNeighbors(to, toNeighbors);
+        for (uint32_t neighbor : toNeighbors)
+            pushEdge(to, neighbor);
+    }
+};
+
+// 一个网格的 LOD 链，全部在加载时离线生成:
+// 第 0 级是原网格，之后每级的三角形数约为上一级的 LevelRatio，由同一次二次误差简化依次截取。
+// 每级作为独立的 Mesh 构建 (顶点缓存/读取优化，丢掉不再引用的顶点) 并上传；Errors[i] 为第 i 级的几何误差 (物体空间)。
+// 运行时按投影到屏幕上的误差选择不超过阈值的最粗一级。投影误差超过阈值的 FadeStart 之后开始淡入细一级，
+// 到达阈值时完全切换，两级之间用抖动丢弃交叉淡化 (g_buffer.fs 的 LOD_CROSSFADE)，切换时不会跳变。
+class MeshLod
+{
+public:
+    static const int MaxLevels = 5;
+    static const int MinTriangles = 32;     // 三角形数低于此值的级别不再生成
+    constexpr static float LevelRatio = 0.25f;
+    constexpr static float FadeStart = 0.7f;
+
+    std::vector<Mesh> Levels;
+    std::vector<float> Errors;
+    float Radius = 0.0f; // 以原点为中心的包围球半径 (物体空间)
+    double BuildMs = 0.0;
+
+    void Build(const float* vertices, int vertexCount, int floatsPerVertex, const std::vector<uint32_t>& indices)
+    {
+        auto start = std::chrono::steady_clock::now();
+        Levels.assign(1, Mesh());
+        Errors.assign(1, 0.0f);
+        Levels[0].Build(vertices, vertexCount, floatsPerVertex, indices);
+
+        // 在焊接后的第 0 级上简化，各级都引用它的顶点
+        std::vector<float> baseVertices = Levels[0].Vertices;
+        std::vector<uint32_t> baseIndices = Levels[0].Indices;
+        int baseVertexCount = Levels[0].VertexCount();
+        std::vector<glm::vec3> positions(baseVertexCount);
+        Radius = 0.0f;
+        for (int v = 0; v < baseVertexCount; ++v)
+        {
+            const float* p = &baseVertices[static_cast<size_t>(v) * floatsPerVertex];
+            positions[v] = glm::vec3(p[0], p[1], p[2]);
+            Radius = std::max(Radius, glm::length(positions[v]));
+        }
+        std::vector<int> targets;
+        int triangles = Levels[0].TriangleCount();
+        while (static_cast<int>(targets.size()) + 1 < MaxLevels)
+        {
+            triangles = static_cast<int>(triangles * LevelRatio);
+            if (triangles < MinTriangles)
+                break;
+            targets.push_back(triangles);
+        }
+        std::vector<std::vector<uint32_t>> levelIndices;
+        std::vector<float> levelErrors;
+        QuadricSimplifier simplifier;
+        simplifier.Simplify(positions, baseIndices, targets, levelIndices, levelErrors);
+        for (size_t level = 0; level < levelIndices.size(); ++level)
+        {
+            Levels.emplace_back();
+            Levels.back().Build(baseVertices.data(), baseVertexCount, floatsPerVertex, levelIndices[level]);
+            Errors.push_back(levelErrors[level]);
+        }
+        BuildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void Upload(const std::vector<VertexAttribute>& attributes)
+    {
+        for (Mesh& level : Levels)
+            level.Upload(attributes);
+    }
+
+    void Destroy()
+    {
+        for (Mesh& level : Levels)
+            level.Destroy();
+    }
+
+    // pixelsPerUnit: 物体空间一个单位投影到屏幕上的像素数；返回选中的级别，
+    // fade > 0 时细一级 (level - 1) 以 fade 的覆盖率淡入，本级以 1 - fade 淡出
+    int SelectLevel(float pixelsPerUnit, float maxPixelError, float& fade) const
+    {
+        fade = 0.0f;
+        int level = 0;
+        for (int i = static_cast<int>(Levels.size()) - 1; i > 0; --i)
+            if (Errors[i] * pixelsPerUnit <= maxPixelError)
+            {
+                level = i;
+                break;
+            }
+        if (level == 0 || maxPixelError <= 0.0f)
+            return level;
+        float ratio = Errors[level] * pixelsPerUnit / maxPixelError;
+        fade = std::clamp((ratio - FadeStart) / (1.0f - FadeStart), 0.0f, 1.0f);
+        if (fade >= 1.0f)
+        {
+            fade = 0.0f;
+            return level - 1;
+        }
+        return level;
+    }
+
+    void PrintSummary(const std::string& name) const
+    {
+        std::cout << "LOD " << name << ": " << Levels.size() << " levels built in " << BuildMs << " ms, triangles";
+        for (const Mesh& level : Levels)
+            std::cout << " " << level.TriangleCount();
+        std::cout << ", error";
+        for (float error : Errors)
+            std::cout << " " << error;
+        std::cout << std::endl;
+    }
+};
+
+// 实例化场景的 LOD 统计: 本帧的值写入基准测试 CSV，累计值在运行结束时打印
+struct LodStats
+{
+    // 本帧
+    int FrameInstances = 0;
+    long long FrameTriangles = 0;
+    float FrameMeanError = 0.0f; // 绘制实例的平均投影误差 (像素，淡化中的实例按较粗一级计)
+
+    // 累计
+    int Frames = 0;
+    long long Instances = 0;
+    long long Triangles = 0;
+    long long FullDetailTriangles = 0; // 全部用第 0 级时的三角形数
+    long long FadingInstances = 0;
+    double ErrorSum = 0.0;
+    float MaxError = 0.0f;
+    std::vector<long long> LevelInstances;
+
+    void PrintSummary() const
+    {
+        if (Frames == 0 || Instances == 0)
+            return;
+        std::cout << "LOD: avg " << Triangles / Frames << " triangles/frame ("
+                  << 100.0 * Triangles / std::max(FullDetailTriangles, 1LL) << "% of full detail), screen error mean "
+                  << ErrorSum / Instances << " px, max " << MaxError << " px, "
+                  << 100.0 * FadingInstances / Instances << "% cross-fading; instances per level";
+        for (long long count : LevelInstances)
+            std::cout << " " << count / Frames;
+        std::cout << std::endl;
+    }
+};
+
+#endif
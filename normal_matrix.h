@@ -0,0 +1,83 @@
+#ifndef NORMAL_MATRIX_H
+#define NORMAL_MATRIX_H
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+// 法线矩阵 (模型矩阵左上 3x3 的逆转置) 的 CPU 预计算
+// 列为 a, b, c 的 3x3 矩阵 M 满足 inverse(M)^T = [b×c, c×a, a×b] / det(M)，det(M) = a·(b×c)，
+// 只需要 3 次叉积和一次除法，不必做通用的 4x4 求逆。
+// 批量版本把 4 个矩阵转成 SoA 后用 SSE 同时计算，逐物体的版本用于非实例化的单独绘制。
+// 各向同性缩放 + 旋转的矩阵逆转置与自身只差一个标量，但 g_buffer.fs 会重新 normalize，
+// 因此同样得到正确方向；这里统一输出精确的逆转置，与着色器中 transpose(inverse(model)) 的结果一致。
+
+inline glm::mat3 ComputeNormalMatrix(const glm::mat4& model)
+{
+    glm::vec3 a(model[0]), b(model[1]), c(model[2]);
+    glm::vec3 bc = glm::cross(b, c);
+    float det = glm::dot(a, bc);
+    float invDet = std::abs(det) > 1e-12f ? 1.0f / det : 0.0f;
+    return glm::mat3(bc * invDet, glm::cross(c, a) * invDet, glm::cross(a, b) * invDet);
+}
+
+// 批量计算 count 个法线矩阵 (models 与 normals 可以是任意对齐的连续数组)
+inline void ComputeNormalMatrices(const glm::mat4* models, glm::mat3* normals, int count)
+{
+    int i = 0;
+#if defined(__SSE2__) || defined(_M_X64)
+    for (; i + 4 <= count; i += 4)
+    {
+        const glm::mat4* m = models + i;
+        // SoA: ax 的 4 个通道分别是 4 个矩阵第 0 列的 x 分量，其余同理
+        __m128 ax = _mm_setr_ps(m[0][0].x, m[1][0].x, m[2][0].x, m[3][0].x);
+        __m128 ay = _mm_setr_ps(m[0][0].y, m[1][0].y, m[2][0].y, m[3][0].y);
+        __m128 az = _mm_setr_ps(m[0][0].z, m[1][0].z, m[2][0].z, m[3][0].z);
+        __m128 bx = _mm_setr_ps(m[0][1].x, m[1][1].x, m[2][1].x, m[3][1].x);
+        __m128 by = _mm_setr_ps(m[0][1].y, m[1][1].y, m[2][1].y, m[3][1].y);
+        __m128 bz = _mm_setr_ps(m[0][1].z, m[1][1].z, m[2][1].z, m[3][1].z);
+        __m128 cx = _mm_setr_ps(m[0][2].x, m[1][2].x, m[2][2].x, m[3][2].x);
+        __m128 cy = _mm_setr_ps(m[0][2].y, m[1][2].y, m[2][2].y, m[3][2].y);
+        __m128 cz = _mm_setr_ps(m[0][2].z, m[1][2].z, m[2][2].z, m[3][2].z);
+
+        // b×c, c×a, a×b
+        __m128 r0x = _mm_sub_ps(_mm_mul_ps(by, cz), _mm_mul_ps(bz, cy));
+        __m128 r0y = _mm_sub_ps(_mm_mul_ps(bz, cx), _mm_mul_ps(bx, cz));
+        __m128 r0z = _mm_sub_ps(_mm_mul_ps(bx, cy), _mm_mul_ps(by, cx));
+        __m128 r1x = _mm_sub_ps(_mm_mul_ps(cy, az), _mm_mul_ps(cz, ay));
+        __m128 r1y = _mm_sub_ps(_mm_mul_ps(cz, ax), _mm_mul_ps(cx, az));
+        __m128 r1z = _mm_sub_ps(_mm_mul_ps(cx, ay), _mm_mul_ps(cy, ax));
+        __m128 r2x = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by));
+        __m128 r2y = _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz));
+        __m128 r2z = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx));
+
+        __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, r0x), _mm_mul_ps(ay, r0y)), _mm_mul_ps(az, r0z));
+        // 退化矩阵 (det 为 0) 输出零矩阵，与标量版本一致
+        __m128 valid = _mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), det), _mm_set1_ps(1e-12f));
+        __m128 invDet = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), det), valid);
+
+        alignas(16) float out[9][4];
+        _mm_store_ps(out[0], _mm_mul_ps(r0x, invDet));
+        _mm_store_ps(out[1], _mm_mul_ps(r0y, invDet));
+        _mm_store_ps(out[2], _mm_mul_ps(r0z, invDet));
+        _mm_store_ps(out[3], _mm_mul_ps(r1x, invDet));
+        _mm_store_ps(out[4], _mm_mul_ps(r1y, invDet));
+        _mm_store_ps(out[5], _mm_mul_ps(r1z, invDet));
+        _mm_store_ps(out[6], _mm_mul_ps(r2x, invDet));
+        _mm_store_ps(out[7], _mm_mul_ps(r2y, invDet));
+        _mm_store_ps(out[8], _mm_mul_ps(r2z, invDet));
+        for (int lane = 0; lane < 4; ++lane)
+            normals[i + lane] = glm::mat3(glm::vec3(out[0][lane], out[1][lane], out[2][lane]),
+                                          glm::vec3(out[3][lane], out[4][lane], out[5][lane]),
+                                          glm::vec3(out[6][lane], out[7][lane], out[8][lane]));
+    }
+#endif
+    for (; i < count; ++i)
+        normals[i] = ComputeNormalMatrix(models[i]);
+}
+
+#endif
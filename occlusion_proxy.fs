@@ -0,0 +1,6 @@
+#version 330 core
+// 遮挡查询的代理包围盒只参与深度测试 (颜色和深度写入都已关闭)，不需要任何输出
+
+void main()
+{
+}
@@ -0,0 +1,9 @@
+#version 330 core
+layout (location = 0) in vec3 aPos; // 单位立方体 [-1, 1] 的顶点
+
+uniform mat4 mvp; // projection * view * (包围盒的平移和缩放)
+
+void main()
+{
+    gl_Position = mvp * vec4(aPos, 1.0);
+}
@@ -0,0 +1,237 @@
+#ifndef OCCLUSION_QUERIES_H
+#define OCCLUSION_QUERIES_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "cpu_profiler.h"
+#include "scene_bvh.h"
+#include "shader_m.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+// 硬件遮挡查询 + 条件渲染 (GL 3.3 核心功能，不需要扩展)
+// 每个被管理的物体 (槽位) 有一个 GL_ANY_SAMPLES_PASSED 查询:
+//   - Proxy: 关闭颜色/深度写入画出物体的包围盒，查询是否有像素通过深度测试
+//   - BeginConditional/EndConditional: 真正的绘制包在 glBeginConditionalRender 中，
+//     查询结果为 0 时 GPU 直接丢弃这些绘制命令，CPU 不需要读回结果，也就不会等待 GPU
+// 几何阶段的代理在整帧几何画完后发出，结果供下一帧使用 (晚一帧，新露出的物体会迟一帧出现)；
+// 光源体积在 G-buffer 深度完整之后才绘制，代理可以在同一帧先发出。
+// 滞后 (hysteresis): 查询结果在可用时异步读回 (只检查 GL_QUERY_RESULT_AVAILABLE，不等待)，
+// 最近 HysteresisFrames 帧内可见过的物体不走条件渲染而是直接绘制，在遮挡边界附近的物体不会逐帧闪烁。
+// 相机在包围盒内 (或离它不到近平面距离) 时包围盒的正面会被裁掉，这种物体不发查询，视为可见。
+class OcclusionQueries
+{
+public:
+    constexpr static float ProxyPadding = 1.05f; // 代理包围盒的放大系数，留出物体在相邻帧间的移动
+
+    int HysteresisFrames = 0;
+
+    // 统计
+    int Frames = 0;
+    long long QueriesIssued = 0;
+    long long ResultsRead = 0;     // 读回时已经可用的查询结果
+    long long ResultsOccluded = 0; // 其中被完全遮挡的
+    long long ConditionalDraws = 0;
+    long long HysteresisDraws = 0; // 滞后期内直接绘制的
+    long long UnqueriedDraws = 0;  // 还没有查询 (刚进入视野/相机在包围盒内) 的直接绘制
+
+    // hysteresisFrames: 可见后保持直接绘制的帧数，0 表示每次都走条件渲染
+    bool Create(int hysteresisFrames)
+    {
+        HysteresisFrames = hysteresisFrames;
+        proxyShader = Shader("../occlusion_proxy.vs", "../occlusion_proxy.fs");
+        if (proxyShader.ID == 0)
+            return false;
+        mvpLocation = glGetUniformLocation(proxyShader.ID, "mvp");
+        createProxyBox();
+        return true;
+    }
+
+    void Destroy()
+    {
+        for (Slot& slot : slots)
+            glDeleteQueries(1, &slot.Query);
+        slots.clear();
+        if (proxyShader.ID != 0)
+            glDeleteProgram(proxyShader.ID);
+        glDeleteVertexArrays(1, &boxVAO);
+        glDeleteBuffers(1, &boxVBO);
+        glDeleteBuffers(1, &boxEBO);
+        proxyShader.ID = 0;
+        boxVAO = boxVBO = boxEBO = 0;
+    }
+
+    // 每帧开始时调用，count 为本帧可能用到的槽位数 (不足时新建查询)
+    void BeginFrame(int count)
+    {
+        ++Frames;
+        while (static_cast<int>(slots.size()) < count)
+        {
+            Slot slot;
+            glGenQueries(1, &slot.Query);
+            slots.push_back(slot);
+        }
+    }
+
+    // 包住槽位 slot 的真正绘制
+    void BeginConditional(int slot)
+    {
+        Slot& s = slots[slot];
+        s.Conditional = false;
+        if (!s.Issued)
+            ++UnqueriedDraws;
+        else if (HysteresisFrames > 0 && Frames - s.LastVisibleFrame <= HysteresisFrames)
+            ++HysteresisDraws;
+        else
+        {
+            // 查询在前面的命令中已经发出，GPU 端等待它完成不会阻塞 CPU
+            glBeginConditionalRender(s.Query, GL_QUERY_WAIT);
+            s.Conditional = true;
+            ++ConditionalDraws;
+        }
+    }
+
+    void EndConditional(int slot)
+    {
+        if (slots[slot].Conditional)
+            glEndConditionalRender();
+        slots[slot].Conditional = false;
+    }
+
+    // 开始发出代理查询: 之后的绘制只做深度测试 (使用当前绑定帧缓冲的深度)
+    void BeginProxies(const glm::mat4& viewProjection, const glm::vec3& viewPos, float nearPlane)
+    {
+        proxyViewProjection = viewProjection;
+        proxyViewPos = viewPos;
+        proxyNearPlane = nearPlane;
+        proxyShader.use();
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        glDepthMask(GL_FALSE);
+        glEnable(GL_DEPTH_TEST);
+        glDepthFunc(GL_LEQUAL); // 包围盒的面可能与物体表面重合
+        glDisable(GL_CULL_FACE);
+        glBindVertexArray(boxVAO);
+    }
+
+    // 先读回上一次查询的结果 (可用时)，再用世界空间包围盒 box 发出新的查询
+    void Proxy(int slot, const Aabb& box)
+    {
+        Slot& s = slots[slot];
+        collect(s);
+        glm::vec3 center = box.Center();
+        glm::vec3 extent = (box.Max - box.Min) * (0.5f * ProxyPadding);
+        glm::vec3 outside = glm::abs(proxyViewPos - center) - extent;
+        if (std::max({ outside.x, outside.y, outside.z }) <= proxyNearPlane * 2.0f)
+        {
+            s.Issued = false;
+            s.LastVisibleFrame = Frames;
+            return;
+        }
+        glm::mat4 mvp = proxyViewProjection * glm::scale(glm::translate(glm::mat4(1.0f), center), extent);
+        glUniformMatrix4fv(mvpLocation, 1, GL_FALSE, &mvp[0][0]);
+        glBeginQuery(GL_ANY_SAMPLES_PASSED, s.Query);
+        glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_BYTE, 0);
+        glEndQuery(GL_ANY_SAMPLES_PASSED);
+        s.Issued = true;
+        s.Pending = true;
+        ++QueriesIssued;
+    }
+
+    // 本帧不发查询的槽位 (例如在视锥体外): 丢弃旧结果，下次出现时先直接绘制
+    void Skip(int slot)
+    {
+        collect(slots[slot]);
+        slots[slot].Issued = false;
+    }
+
+    void EndProxies()
+    {
+        glBindVertexArray(0);
+        glDepthFunc(GL_LESS);
+        glDepthMask(GL_TRUE);
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    }
+
+    void PrintSummary(const char* name) const
+    {
+        if (Frames == 0)
+            return;
+        std::cout << name << " occlusion queries: avg " << QueriesIssued / Frames << " queries, "
+                  << ConditionalDraws / Frames << " conditional, " << HysteresisDraws / Frames << " hysteresis, "
+                  << UnqueriedDraws / Frames << " unqueried draws per frame; "
+                  << (QueriesIssued > 0 ? 100.0 * ResultsRead / QueriesIssued : 0.0) << "% results available without waiting, "
+                  << (ResultsRead > 0 ? 100.0 * ResultsOccluded / ResultsRead : 0.0) << "% occluded" << std::endl;
+    }
+
+private:
+    struct Slot
+    {
+        unsigned int Query = 0;
+        bool Issued = false;      // 查询已发出，可用于条件渲染
+        bool Pending = false;     // 结果还没有读回
+        bool Conditional = false; // 正处于这个查询的条件渲染中
+        int LastVisibleFrame = -1000000;
+    };
+
+    Shader proxyShader;
+    GLint mvpLocation = -1;
+    unsigned int boxVAO = 0, boxVBO = 0, boxEBO = 0;
+    std::vector<Slot> slots;
+    glm::mat4 proxyViewProjection = glm::mat4(1.0f);
+    glm::vec3 proxyViewPos = glm::vec3(0.0f);
+    float proxyNearPlane = 0.0f;
+
+    // 结果还没准备好就不读 (不等待 GPU)，滞后和统计只用已经可用的结果
+    void collect(Slot& s)
+    {
+        if (!s.Pending)
+            return;
+        GLuint available = 0;
+        glGetQueryObjectuiv(s.Query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            return;
+        GLuint anySamples = 0;
+        glGetQueryObjectuiv(s.Query, GL_QUERY_RESULT, &anySamples);
+        s.Pending = false;
+        ++ResultsRead;
+        if (anySamples)
+            s.LastVisibleFrame = Frames;
+        else
+            ++ResultsOccluded;
+    }
+
+    // 单位立方体 [-1, 1]，只有位置
+    void createProxyBox()
+    {
+        float vertices[24];
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            vertices[corner * 3 + 0] = (corner & 1) ? 1.0f : -1.0f;
+            vertices[corner * 3 + 1] = (corner & 2) ? 1.0f : -1.0f;
+            vertices[corner * 3 + 2] = (corner & 4) ? 1.0f : -1.0f;
+        }
+        // 双面绘制，不关心环绕方向
+        unsigned char indices[36] = {
+            0, 1, 3, 0, 3, 2,  4, 5, 7, 4, 7, 6,  // -z, +z
+            0, 1, 5, 0, 5, 4,  2, 3, 7, 2, 7, 6,  // -y, +y
+            0, 2, 6, 0, 6, 4,  1, 3, 7, 1, 7, 5   // -x, +x
+        };
+        glGenVertexArrays(1, &boxVAO);
+        glGenBuffers(1, &boxVBO);
+        glGenBuffers(1, &boxEBO);
+        glBindVertexArray(boxVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, boxVBO);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, boxEBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
+        glBindVertexArray(0);
+    }
+};
+
+#endif
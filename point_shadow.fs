@@ -0,0 +1,10 @@
+#version 330 core
+// 深度写入到光源的线性距离 (除以半径归一化到 [0,1])，光照阶段直接与片段到光源的距离比较
+in vec3 WorldPos;
+
+uniform vec4 lightPositionRadius; // xyz: 光源位置, w: 影响半径
+
+void main()
+{
+    gl_FragDepth = length(WorldPos - lightPositionRadius.xyz) / lightPositionRadius.w;
+}
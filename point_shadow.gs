@@ -0,0 +1,37 @@
+#version 330 core
+#extension GL_ARB_viewport_array : require
+// 单次绘制写入点光源阴影的 6 个面: 每个三角形复制 6 份，gl_ViewportIndex 选择阴影图集中该面的图块
+layout (triangles) in;
+layout (triangle_strip, max_vertices = 18) out;
+
+uniform mat4 faceMatrices[6]; // 各面的投影 * 视图 (顺序与 GL_TEXTURE_CUBE_MAP_POSITIVE_X.. 一致)
+
+out vec3 WorldPos;
+
+void main()
+{
+    for (int face = 0; face < 6; ++face)
+    {
+        vec4 clip[3];
+        for (int i = 0; i < 3; ++i)
+            clip[i] = faceMatrices[face] * gl_in[i].gl_Position;
+        // 三个顶点都在同一个裁剪平面外时，这个面看不到这个三角形，跳过
+        bool outside = false;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            outside = outside || (clip[0][axis] > clip[0].w && clip[1][axis] > clip[1].w && clip[2][axis] > clip[2].w)
+                              || (clip[0][axis] < -clip[0].w && clip[1][axis] < -clip[1].w && clip[2][axis] < -clip[2].w);
+        }
+        if (outside)
+            continue;
+
+        gl_ViewportIndex = face;
+        for (int i = 0; i < 3; ++i)
+        {
+            WorldPos = gl_in[i].gl_Position.xyz;
+            gl_Position = clip[i];
+            EmitVertex();
+        }
+        EndPrimitive();
+    }
+}
@@ -0,0 +1,14 @@
+#version 330 core
+// 点光源立方体阴影: 顶点只变换到世界空间，6 个面的投影在 point_shadow.gs 中完成
+layout (location = 0) in vec3 aPos;
+
+#ifndef VERTEX_POSITION
+#define VERTEX_POSITION(p) (p) // 位置未量化 (量化时由 vertex_format.h 生成的定义给出反量化)
+#endif
+
+uniform mat4 model;
+
+void main()
+{
+    gl_Position = model * vec4(VERTEX_POSITION(aPos), 1.0);
+}
@@ -0,0 +1,367 @@
+#ifndef POINT_SHADOWS_H
+#define POINT_SHADOWS_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "cpu_profiler.h"
+#include "lights.h"
+#include "shader_m.h"
+#include "shadow_atlas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// 投射物的包围球 (用于判断缓存是否失效)
+struct CasterBounds
+{
+    glm::vec3 Center;
+    float Radius;
+};
+
+// 带缓存的点光源全向阴影，全部光源共用一张阴影图集 (需要 GL 4.1 的视口数组)
+// 每个光源的立方体阴影拆成 6 个正方形面，各自从图集的四叉树分配器 (shadow_atlas.h) 中分配。
+// 面的边长 (档位) 每帧按光源在屏幕上的投影半径重新决定，离得近的光源拿到更高的分辨率；
+// 图集大小由显存预算决定，放不下时从屏幕上最小的光源开始降档，最后放不下的光源本帧没有阴影。
+// 每个光源一次绘制写入全部 6 个面: point_shadow.gs 把三角形复制到各个面并设置 gl_ViewportIndex，
+// 深度为到光源的线性距离。光源位置/半径和分到的图块都没有变化，且没有运动的投射物
+// (本帧或上一帧的位置) 进入光源半径时，直接复用图集中上次的结果。
+class PointShadowMaps
+{
+public:
+    static const int MaxTileSize = 512;         // 面的最大边长 (texel)，也是图集四叉树根节点的大小
+    static const int MinTileSize = 32;          // 面的最小边长，再小就不给阴影
+    static const int MaxLights = 64;            // 最多带阴影的光源数量
+    static const unsigned int TextureUnit = 12; // 图集的纹理单元 (级联阴影占 11)
+    static const unsigned int TileTextureUnit = 13; // 图块表 (纹理缓冲) 的纹理单元
+    constexpr static float NearPlane = 0.05f;
+    constexpr static float TierHysteresis = 0.25f; // 投影大小超出当前档位这个比例后才换档，避免在边界上来回切换
+
+    // 绘制投射物的回调: 调用方负责设置 model 并绘制
+    typedef std::function<void(const Shader&)> DrawCasters;
+
+    Shader DepthShader;
+    unsigned int Atlas = 0;       // GL_DEPTH_COMPONENT24 的 2D 纹理
+    unsigned int FBO = 0;
+    unsigned int TileBuffer = 0, TileTexture = 0; // 每个光源 6 个 RGBA32F: (x, y, 边长, 0)，单位为 texel
+    int AtlasSize = 0;
+    int Count = 0;                // 带阴影的光源数量
+
+    // 累计统计
+    int Frames = 0;
+    int Renders = 0;
+    int CacheHits = 0;
+    int Reassignments = 0;        // 分到的图块与上一帧不同 (档位变化或被挤到别处) 的次数
+    int Unshadowed = 0;           // 图集放不下而没有阴影的次数
+    double UsedFraction = 0.0;    // 图集占用率的累计值
+
+    // budgetMB: 图集的显存上限; vertexDefines: 网格顶点格式的着色器定义
+    // 在编译光照着色器之前调用，只有成功时光照着色器才以 POINT_SHADOWS 编译，再调用 BindLightingShader
+    bool Create(int count, float budgetMB, const std::string& vertexDefines = "")
+    {
+        if (!GLAD_GL_VERSION_4_1)
+        {
+            std::cout << "ERROR::POINT_SHADOWS::REQUIRES_GL_4_1" << std::endl;
+            return false;
+        }
+        DepthShader = Shader::WithGeometry("../point_shadow.vs", "../point_shadow.gs", "../point_shadow.fs", vertexDefines);
+        if (DepthShader.ID == 0)
+            return false;
+        faceMatricesLocation = glGetUniformLocation(DepthShader.ID, "faceMatrices");
+        lightPositionRadiusLocation = glGetUniformLocation(DepthShader.ID, "lightPositionRadius");
+
+        // 每个 texel 4 字节，边长取 MaxTileSize 的整数倍，至少放得下一个根节点
+        int side = static_cast<int>(std::sqrt(std::max(budgetMB, 0.0f) * 1024.0f * 1024.0f / 4.0f));
+        AtlasSize = std::max(side / MaxTileSize, 1) * MaxTileSize;
+        allocator.Init(AtlasSize, MaxTileSize);
+
+        Count = std::min(count, MaxLights);
+        cache.assign(Count, CacheEntry());
+        tiles.assign(Count * 6, glm::vec4(0.0f));
+
+        glGenTextures(1, &Atlas);
+        glBindTexture(GL_TEXTURE_2D, Atlas);
+        // glTexStorage2D 从 4.2 起才是核心功能，4.1 上下文 (如 macOS) 回退到 glTexImage2D
+        if (GLAD_GL_VERSION_4_2)
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH_COMPONENT24, AtlasSize, AtlasSize);
+        else
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, AtlasSize, AtlasSize, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glGenFramebuffers(1, &FBO);
+        glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, Atlas, 0);
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+            std::cout << "ERROR::POINT_SHADOWS::FRAMEBUFFER_INCOMPLETE" << std::endl;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        glGenBuffers(1, &TileBuffer);
+        glBindBuffer(GL_TEXTURE_BUFFER, TileBuffer);
+        glBufferData(GL_TEXTURE_BUFFER, std::max<size_t>(tiles.size(), 1) * sizeof(glm::vec4), nullptr, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+        glGenTextures(1, &TileTexture);
+        glBindTexture(GL_TEXTURE_BUFFER, TileTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, TileBuffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+        std::cout << "Point shadow atlas: " << AtlasSize << "x" << AtlasSize << " ("
+                  << AtlasSize * static_cast<double>(AtlasSize) * 4.0 / (1024.0 * 1024.0) << " MB)" << std::endl;
+        return true;
+    }
+
+    // lightingShader: 以 POINT_SHADOWS 编译的光照着色器
+    void BindLightingShader(const Shader& lightingShader) const
+    {
+        lightingShader.use();
+        lightingShader.setInt("pointShadowAtlas", TextureUnit);
+        lightingShader.setInt("pointShadowTiles", TileTextureUnit);
+        lightingShader.setInt("pointShadowCount", Count);
+        lightingShader.setFloat("pointShadowAtlasSize", static_cast<float>(AtlasSize));
+    }
+
+    void Destroy()
+    {
+        if (DepthShader.ID != 0)
+            glDeleteProgram(DepthShader.ID);
+        glDeleteTextures(1, &Atlas);
+        glDeleteFramebuffers(1, &FBO);
+        glDeleteBuffers(1, &TileBuffer);
+        glDeleteTextures(1, &TileTexture);
+        DepthShader.ID = 0;
+        Atlas = FBO = TileBuffer = TileTexture = 0;
+        Count = 0;
+    }
+
+    // 每帧在光照阶段之前调用一次
+    // movingCasters: 本帧运动投射物的包围球 (顺序每帧一致)，与上一帧的位置一起用于判断缓存失效
+    // view/projection/screenHeight: 用于估算光源在屏幕上的投影大小
+    void Update(const std::vector<PointLight>& lights, const std::vector<CasterBounds>& movingCasters,
+                const glm::mat4& view, const glm::mat4& projection, int screenHeight, const DrawCasters& drawCasters)
+    {
+        CPU_PROFILE_SCOPE("point_shadows");
+        if (DepthShader.ID == 0)
+            return;
+        ++Frames;
+        int active = std::min(Count, static_cast<int>(lights.size()));
+        assignTiles(lights, active, view, projection, screenHeight);
+
+        // 收集需要重画的光源
+        dirty.clear();
+        for (int i = 0; i < active; ++i)
+        {
+            CacheEntry& entry = cache[i];
+            if (tiles[i * 6].z == 0.0f)
+            {
+                entry.Valid = false; // 本帧没有阴影，图块可能已经分给别的光源
+                continue;
+            }
+            bool moved = !std::equal(tiles.begin() + i * 6, tiles.begin() + i * 6 + 6, entry.Tiles);
+            if (moved && entry.Valid)
+                ++Reassignments;
+            bool stale = moved || !entry.Valid || lights[i].PositionRadius != entry.PositionRadius;
+            for (size_t c = 0; c < movingCasters.size() && !stale; ++c)
+            {
+                stale = intersects(lights[i].PositionRadius, movingCasters[c])
+                    || (c < previousCasters.size() && intersects(lights[i].PositionRadius, previousCasters[c]));
+            }
+            if (stale)
+                dirty.push_back(i);
+            else
+                ++CacheHits;
+        }
+        previousCasters = movingCasters;
+
+        // 图块表每帧上传 (分配每帧都可能变化)
+        glBindBuffer(GL_TEXTURE_BUFFER, TileBuffer);
+        glBufferSubData(GL_TEXTURE_BUFFER, 0, tiles.size() * sizeof(glm::vec4), tiles.data());
+        glBindBuffer(GL_TEXTURE_BUFFER, 0);
+        if (dirty.empty())
+            return;
+
+        GLint viewport[4];
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        glBindFramebuffer(GL_FRAMEBUFFER, FBO);
+        glEnable(GL_DEPTH_TEST);
+        glDepthMask(GL_TRUE);
+        glEnable(GL_SCISSOR_TEST);
+        DepthShader.use();
+
+        for (int i : dirty)
+        {
+            const glm::vec4* lightTiles = &tiles[i * 6];
+            // 清除只使用 0 号剪裁矩形，逐个面清除
+            for (int face = 0; face < 6; ++face)
+            {
+                glScissorIndexed(0, static_cast<int>(lightTiles[face].x), static_cast<int>(lightTiles[face].y),
+                                 static_cast<int>(lightTiles[face].z), static_cast<int>(lightTiles[face].z));
+                glClear(GL_DEPTH_BUFFER_BIT);
+            }
+            // 6 个视口/剪裁矩形对应 6 个面，几何着色器用 gl_ViewportIndex 选择
+            for (int face = 0; face < 6; ++face)
+            {
+                glViewportIndexedf(face, lightTiles[face].x, lightTiles[face].y, lightTiles[face].z, lightTiles[face].z);
+                glScissorIndexed(face, static_cast<int>(lightTiles[face].x), static_cast<int>(lightTiles[face].y),
+                                 static_cast<int>(lightTiles[face].z), static_cast<int>(lightTiles[face].z));
+            }
+            const glm::vec4& positionRadius = lights[i].PositionRadius;
+            glm::mat4 faceMatrices[6];
+            buildFaceMatrices(glm::vec3(positionRadius), positionRadius.w, faceMatrices);
+            glUniformMatrix4fv(faceMatricesLocation, 6, GL_FALSE, glm::value_ptr(faceMatrices[0]));
+            glUniform4fv(lightPositionRadiusLocation, 1, glm::value_ptr(positionRadius));
+            drawCasters(DepthShader);
+
+            cache[i].Valid = true;
+            cache[i].PositionRadius = positionRadius;
+            std::copy(lightTiles, lightTiles + 6, cache[i].Tiles);
+            ++Renders;
+        }
+
+        glDisable(GL_SCISSOR_TEST);
+        // glViewport 同时重置全部视口
+        glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    }
+
+    // 在光照着色器 use() 之后调用，绑定图集和图块表
+    void Bind() const
+    {
+        glActiveTexture(GL_TEXTURE0 + TextureUnit);
+        glBindTexture(GL_TEXTURE_2D, Atlas);
+        glActiveTexture(GL_TEXTURE0 + TileTextureUnit);
+        glBindTexture(GL_TEXTURE_BUFFER, TileTexture);
+        glActiveTexture(GL_TEXTURE0);
+    }
+
+    void PrintSummary() const
+    {
+        if (DepthShader.ID == 0 || Frames == 0)
+            return;
+        int total = Renders + CacheHits;
+        std::cout << "Point shadows: " << Count << " lights, atlas " << AtlasSize << "x" << AtlasSize << ", "
+                  << Renders << " renders, " << CacheHits << " cache hits (" << (total > 0 ? 100.0 * CacheHits / total : 0.0) << "%), "
+                  << Reassignments << " tile reassignments, " << Unshadowed << " unshadowed, "
+                  << 100.0 * UsedFraction / Frames << "% atlas used" << std::endl;
+        // 最近一帧各档位的光源数量
+        std::cout << "  tiles (last frame):";
+        for (int size = MaxTileSize; size >= MinTileSize; size /= 2)
+        {
+            int lightsAtSize = 0;
+            for (int i = 0; i < Count; ++i)
+                lightsAtSize += tiles[i * 6].z == static_cast<float>(size) ? 1 : 0;
+            std::cout << " " << size << ":" << lightsAtSize;
+        }
+        std::cout << std::endl;
+    }
+
+private:
+    struct CacheEntry
+    {
+        bool Valid = false;
+        glm::vec4 PositionRadius = glm::vec4(0.0f);
+        glm::vec4 Tiles[6] = {};
+    };
+    std::vector<CacheEntry> cache;
+    std::vector<glm::vec4> tiles; // 本帧的分配结果，即上传到 TileBuffer 的内容
+    std::vector<CasterBounds> previousCasters;
+    std::vector<int> dirty;
+    std::vector<int> order;
+    std::vector<float> pixelRadius;
+    std::vector<int> desiredSize;
+    ShadowAtlasAllocator allocator;
+
+    int faceMatricesLocation = -1;
+    int lightPositionRadiusLocation = -1;
+
+    // 按屏幕投影半径重新分配全部图块
+    void assignTiles(const std::vector<PointLight>& lights, int active, const glm::mat4& view, const glm::mat4& projection, int screenHeight)
+    {
+        pixelRadius.assign(active, 0.0f);
+        for (int i = 0; i < active; ++i)
+        {
+            glm::vec3 viewPos = glm::vec3(view * glm::vec4(glm::vec3(lights[i].PositionRadius), 1.0f));
+            float radius = lights[i].PositionRadius.w;
+            float distance = glm::length(viewPos);
+            if (distance <= radius)
+                pixelRadius[i] = 1e30f; // 摄像机在光源范围内
+            else if (viewPos.z > radius)
+                pixelRadius[i] = 0.0f;  // 整个球在摄像机后面
+            else
+                pixelRadius[i] = radius / std::sqrt(distance * distance - radius * radius) * projection[1][1] * 0.5f * screenHeight;
+        }
+        // 期望的档位: 不小于投影半径的 2 的幂，上一帧的档位在容差范围内时保持不变
+        desiredSize.resize(active);
+        for (int i = 0; i < active; ++i)
+        {
+            int size = MinTileSize;
+            while (size < MaxTileSize && size < pixelRadius[i])
+                size *= 2;
+            int previous = static_cast<int>(cache[i].Tiles[0].z);
+            if (previous > 0 && pixelRadius[i] <= previous * (1.0f + TierHysteresis)
+                && pixelRadius[i] > previous * 0.5f * (1.0f - TierHysteresis))
+                size = previous;
+            desiredSize[i] = size;
+        }
+        // 档位越高越优先，相同时按序号，档位不变时分配结果也不变 (缓存才能命中)
+        order.resize(active);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return desiredSize[a] > desiredSize[b]; });
+
+        allocator.Reset();
+        std::fill(tiles.begin(), tiles.end(), glm::vec4(0.0f));
+        long long capacity = static_cast<long long>(AtlasSize) * AtlasSize;
+        // 后面的光源不超过前面已分配的档位，尺寸单调不增时四叉树分配只要面积够就一定成功
+        int sizeCap = MaxTileSize;
+        for (int i : order)
+        {
+            int size = std::min(desiredSize[i], sizeCap);
+            while (size >= MinTileSize && allocator.UsedTexels + 6LL * size * size > capacity)
+                size /= 2;
+            if (size < MinTileSize)
+            {
+                ++Unshadowed;
+                continue;
+            }
+            sizeCap = size;
+            for (int face = 0; face < 6; ++face)
+            {
+                glm::ivec2 origin = allocator.Allocate(size);
+                tiles[i * 6 + face] = glm::vec4(origin.x, origin.y, size, 0.0f);
+            }
+        }
+        UsedFraction += static_cast<double>(allocator.UsedTexels) / capacity;
+    }
+
+    static bool intersects(const glm::vec4& light, const CasterBounds& caster)
+    {
+        float reach = light.w + caster.Radius;
+        glm::vec3 d = glm::vec3(light) - caster.Center;
+        return glm::dot(d, d) < reach * reach;
+    }
+
+    // 立方体贴图 6 个面的观察方向与上方向 (与 GL 的面约定一致，lighting_pass.fs 按同样的约定计算面内坐标)
+    static void buildFaceMatrices(const glm::vec3& position, float radius, glm::mat4 out[6])
+    {
+        glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, NearPlane, radius);
+        out[0] = projection * glm::lookAt(position, position + glm::vec3( 1.0f,  0.0f,  0.0f), glm::vec3(0.0f, -1.0f,  0.0f));
+        out[1] = projection * glm::lookAt(position, position + glm::vec3(-1.0f,  0.0f,  0.0f), glm::vec3(0.0f, -1.0f,  0.0f));
+        out[2] = projection * glm::lookAt(position, position + glm::vec3( 0.0f,  1.0f,  0.0f), glm::vec3(0.0f,  0.0f,  1.0f));
+        out[3] = projection * glm::lookAt(position, position + glm::vec3( 0.0f, -1.0f,  0.0f), glm::vec3(0.0f,  0.0f, -1.0f));
+        out[4] = projection * glm::lookAt(position, position + glm::vec3( 0.0f,  0.0f,  1.0f), glm::vec3(0.0f, -1.0f,  0.0f));
+        out[5] = projection * glm::lookAt(position, position + glm::vec3( 0.0f,  0.0f, -1.0f), glm::vec3(0.0f, -1.0f,  0.0f));
+    }
+};
+
+#endif
@@ -0,0 +1,447 @@
+#ifndef RENDER_OPTIONS_H
+#define RENDER_OPTIONS_H
+
+#include <string>
+#include <cstdlib>
+#include <iostream>
+
+// G-buffer 布局
+enum GBufferLayout
+{
+    GBUFFER_CLASSIC,          // RGB16F 位置 + RGB16F 法线 + RGBA8 反照率/镜面，深度为 renderbuffer
+    GBUFFER_DEPTH_RECONSTRUCT, // 去掉位置附件，深度改为可采样纹理，光照阶段由深度重建世界坐标
+    GBUFFER_PACKED             // 在深度重建的基础上，法线八面体编码后存入 RG16
+};
+
+// 光照阶段的实现方式
+enum LightingPath
+{
+    LIGHTING_QUAD,  // 全屏四边形 + lighting_pass.fs，逐像素遍历 uniform block 中的光源 (最多 LightBuffer::MaxLights 个)
+    LIGHTING_TILED, // 计算着色器分块剔除光源 (tiled_lighting.cs，需要 GL 4.3，不支持时回退到 quad)
+    LIGHTING_CLUSTERED, // CPU 多线程分簇，结果以纹理缓冲交给 lighting_pass.fs (GL 3.3 即可)
+    LIGHTING_VOLUMES    // 每个光源画包围球，模板 + 剪裁矩形限定着色范围，加法混合 (light_volumes.h)
+};
+
+// 方向光级联阴影 (cascaded_shadows.h)
+enum ShadowMode
+{
+    SHADOWS_OFF,   // 没有方向光和阴影 (原来的场景)
+    SHADOWS_FULL,  // 每帧重新拟合并绘制全部级联和投射物
+    SHADOWS_CACHED // 静态投射物缓存在单独的深度层，远处级联隔帧更新
+};
+
+// 网格的顶点格式 (属性编码见 vertex_format.h 中的描述表)
+enum VertexFormat
+{
+    VERTEX_FORMAT_FLOAT,     // 位置/法线/纹理坐标全部为 float (32 字节/顶点)
+    VERTEX_FORMAT_COMPRESSED // 16 位量化位置 + 10_10_10_2 法线 + 半精度纹理坐标 (16 字节/顶点)
+};
+
+// 几何阶段的可见性剔除
+enum CullingMode
+{
+    CULLING_OFF,     // 所有物体都绘制 (原来的做法)
+    CULLING_FRUSTUM, // CPU 遍历场景 BVH 做视锥体剔除，几何阶段只绘制可见列表
+    CULLING_GPU,     // 计算着色器逐物体视锥体剔除并生成间接绘制命令，几何阶段一次 multi-draw indirect (需要 GL 4.3)
+    CULLING_HIZ,     // 在 CULLING_GPU 的基础上做两阶段 Hi-Z 遮挡剔除 (上一帧可见集合 + 本帧深度金字塔)
+    CULLING_SOFTWARE, // 在 CULLING_FRUSTUM 的基础上用 CPU 软件光栅化的遮挡缓冲剔除被大物体挡住的物体
+    CULLING_QUERIES   // 实例按空间分簇，簇包围盒做视锥体测试，再用上一帧的硬件遮挡查询条件渲染 (occlusion_queries.h)
+};
+
+// 几何阶段法线矩阵的来源
+enum NormalMatrixMode
+{
+    NORMAL_MATRIX_SHADER,     // 顶点着色器逐顶点计算 transpose(inverse(model)) (原来的做法)
+    NORMAL_MATRIX_PRECOMPUTED // CPU 每个物体算一次，随 uniform / 实例数据上传
+};
+
+// 运行选项，全部来自命令行参数
+// 不带参数运行时行为与原来一致：打开窗口，交互式渲染
+struct RenderOptions
+{
+    // 无窗口(离屏)模式，使用 EGL surfaceless 上下文，可在 Mesa llvmpipe 上运行
+    bool headless = false;
+    // 基准测试帧数，0 表示不限帧数(交互模式)
+    int benchmarkFrames = 0;
+    // 固定分辨率 (0 表示使用默认窗口大小)
+    unsigned int width = 0;
+    unsigned int height = 0;
+    // 每帧耗时输出的 CSV 文件路径
+    std::string csvPath = "frame_times.csv";
+    // 各渲染阶段 GPU 耗时 CSV 的输出路径，空表示不导出 (基准测试模式默认导出)
+    std::string gpuCsvPath;
+    // CPU 分析器 trace 的输出路径 (需要以 ENABLE_CPU_PROFILER 编译)
+    std::string cpuTracePath = "cpu_trace.json";
+    // 输入录制/回放文件路径 (见 input_replay.h)
+    std::string recordPath;
+    std::string replayPath;
+    // 回放时使用的固定 deltaTime (秒)，0 表示使用录制时的真实 deltaTime
+    float fixedDeltaTime = 1.0f / 60.0f;
+    // G-buffer 布局，可分别运行基准测试进行对比
+    GBufferLayout gBufferLayout = GBUFFER_CLASSIC;
+    // 主光源之外额外生成的动态点光源数量
+    int lightCount = 0;
+    LightingPath lightingPath = LIGHTING_QUAD;
+    // 光源体积路径中先对每个光源的包围盒做遮挡查询，被几何体完全挡住的光源由条件渲染跳过
+    bool lightQueries = false;
+    // CPU 工作线程总数 (包括主线程)，0 表示使用全部硬件线程
+    int threadCount = 0;
+    // 开启阴影时场景中加入方向光、地面和一个运动的立方体
+    ShadowMode shadowMode = SHADOWS_OFF;
+    // 带立方体阴影的点光源数量 (从主光源开始数)，0 表示关闭
+    int pointShadowCount = 0;
+    // 额外的点光源保持在初始位置，不做圆周运动
+    bool staticLights = false;
+    // 点光源阴影图集的显存上限 (MB)
+    float shadowAtlasMB = 32.0f;
+    // 实例化压力测试: 几何阶段额外绘制的立方体实例数，0 表示关闭
+    int instanceCount = 0;
+    // 基准测试中实例数从 0 线性增长到 instanceCount，用于绘制吞吐量曲线
+    bool instanceRamp = false;
+    NormalMatrixMode normalMatrixMode = NORMAL_MATRIX_SHADER;
+    VertexFormat vertexFormat = VERTEX_FORMAT_FLOAT;
+    CullingMode cullingMode = CULLING_OFF;
+    // 连续 LOD: 实例化场景改为高面数岩石，按屏幕空间误差选择离线简化出的 LOD 级别
+    bool lod = false;
+    // LOD 允许的投影误差 (像素)
+    float lodError = 1.0f;
+    // 基准测试中 LOD 误差阈值从 0 线性增长到 lodError，用于绘制三角形吞吐量-误差曲线
+    bool lodRamp = false;
+    // 多材质场景: 几何阶段额外单独绘制的物体数，0 表示关闭
+    int materialObjects = 0;
+    // 多材质场景的材质数 (纹理 + 着色器变体)
+    int materialCount = 16;
+    // 几何阶段的单独绘制按 64 位排序键基数排序，并跳过冗余的状态绑定 (render_queue.h)
+    bool renderQueue = false;
+};
+
+inline void PrintRenderOptionsUsage(const char* program)
+{
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --headless            离屏渲染 (EGL surfaceless)，默认渲染 600 帧后退出\n"
+              << "  --frames N            渲染 N 帧后退出，并把每帧耗时写入 CSV\n"
+              << "  --size WxH            固定渲染分辨率，例如 1920x1080\n"
+              << "  --csv PATH            每帧耗时 CSV 的输出路径 (默认 frame_times.csv)\n"
+              << "  --gpu-csv PATH        各渲染阶段 GPU 耗时 CSV 的输出路径 (基准测试默认 gpu_passes.csv)\n"
+              << "  --cpu-trace PATH      CPU trace JSON 的输出路径 (默认 cpu_trace.json，F3 或退出时写入)\n"
+              << "  --record PATH         把每帧输入与初始摄像机状态录制到二进制文件 (只用于窗口下的实时输入)\n"
+              << "  --replay PATH         回放录制文件驱动摄像机 (未指定 --frames 时帧数取录制帧数)\n"
+              << "  --fixed-dt SECONDS    回放时的固定 deltaTime (默认 1/60，0 表示使用录制时的值)\n"
+              << "  --gbuffer LAYOUT      G-buffer 布局: classic (默认) | depth (由深度重建位置) | packed (再加八面体法线)\n"
+              << "  --lights N            额外生成 N 个动态点光源 (默认 0，只有主光源)\n"
+              << "  --lighting PATH       光照路径: quad (默认，全屏四边形遍历全部光源) | tiled (计算着色器分块剔除) | clustered (CPU 分簇) | volumes (光源体积)\n"
+              << "  --light-queries       光源体积路径: 用硬件遮挡查询 + 条件渲染跳过被完全遮挡的光源\n"
+              << "  --threads N           CPU 并行任务使用的线程数 (默认使用全部硬件线程)\n"
+              << "  --shadows MODE        方向光级联阴影: off (默认) | full (每帧全部重画) | cached (静态层缓存 + 远处级联隔帧更新)\n"
+              << "  --point-shadows N     前 N 个点光源 (包括主光源) 使用带缓存的全向阴影 (需要 GL 4.1)\n"
+              << "  --shadow-atlas-mb MB  点光源阴影图集的显存上限 (默认 32)，各光源的分辨率按屏幕大小在其中分配\n"
+              << "  --static-lights       额外的点光源保持静止 (点光源阴影缓存只在光源和投射物都不动时命中)\n"
+              << "  --instances N         几何阶段用一次实例化绘制额外画 N 个立方体 (压力测试)\n"
+              << "  --instance-ramp       基准测试中实例数从 0 逐帧增长到 N，CSV 的 objects 列记录每帧物体数\n"
+              << "  --normal-matrix MODE  法线矩阵: shader (默认，逐顶点求逆) | precomputed (CPU 逐物体预计算后上传)\n"
+              << "  --vertex-format FMT   网格顶点格式: float (默认，32 B) | compressed (量化位置/打包法线/半精度纹理坐标，16 B)\n"
+              << "  --culling MODE        几何阶段剔除: off (默认) | frustum (CPU 场景 BVH 视锥体剔除，多线程) | gpu (计算着色器剔除 + 间接绘制) | hiz (gpu + 两阶段 Hi-Z 遮挡剔除) | software (frustum + CPU 软件光栅化遮挡剔除) | queries (实例分簇 + 硬件遮挡查询条件渲染)\n"
+              << "  --lod                 实例化场景改为高面数岩石，按屏幕空间误差选择 LOD 并交叉淡化 (需要 --instances，只支持 --culling off | frustum)\n"
+              << "  --lod-error PX        LOD 允许的投影误差 (像素，默认 1)\n"
+              << "  --lod-ramp            基准测试中误差阈值从 0 逐帧增长到 --lod-error，CSV 记录每帧三角形数和平均误差\n"
+              << "  --material-objects N  几何阶段额外单独绘制 N 个随机材质的物体 (绘制排序的压力测试)\n"
+              << "  --materials N         多材质场景的材质数 (默认 16)\n"
+              << "  --render-queue        单独绘制的物体按排序键基数排序并跳过冗余绑定 (默认按提交顺序逐项绑定)，退出时打印每帧状态切换数\n"
+              << "  --help                显示此帮助" << std::endl;
+}
+
+// 解析命令行参数，失败时打印用法并返回 false
+inline bool ParseRenderOptions(int argc, char* argv[], RenderOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        // 需要值的参数统一在这里取下一个 argv
+        auto nextValue = [&](std::string& value) -> bool {
+            if (i + 1 >= argc)
+            {
+                std::cout << "ERROR::OPTIONS::MISSING_VALUE: " << arg << std::endl;
+                return false;
+            }
+            value = argv[++i];
+            return true;
+        };
+
+        std::string value;
+        if (arg == "--headless")
+        {
+            options.headless = true;
+        }
+        else if (arg == "--frames")
+        {
+            if (!nextValue(value))
+                return false;
+            options.benchmarkFrames = std::atoi(value.c_str());
+        }
+        else if (arg == "--size")
+        {
+            if (!nextValue(value))
+                return false;
+            // 形如 WxH，两个值都必须是完整的正整数
+            const char* text = value.c_str();
+            char* end = nullptr;
+            long width = std::strtol(text, &end, 10);
+            bool valid = end != text && *end == 'x';
+            long height = 0;
+            if (valid)
+            {
+                const char* heightText = end + 1;
+                height = std::strtol(heightText, &end, 10);
+                valid = end != heightText && *end == '\0';
+            }
+            const long maxSize = 16384;
+            if (!valid || width <= 0 || height <= 0 || width > maxSize || height > maxSize)
+            {
+                std::cout << "ERROR::OPTIONS::INVALID_SIZE: " << value << std::endl;
+                return false;
+            }
+            options.width = static_cast<unsigned int>(width);
+            options.height = static_cast<unsigned int>(height);
+        }
+        else if (arg == "--csv")
+        {
+            if (!nextValue(value))
+                return false;
+            options.csvPath = value;
+        }
+        else if (arg == "--gpu-csv")
+        {
+            if (!nextValue(value))
+                return false;
+            options.gpuCsvPath = value;
+        }
+        else if (arg == "--cpu-trace")
+        {
+            if (!nextValue(value))
+                return false;
+            options.cpuTracePath = value;
+        }
+        else if (arg == "--record")
+        {
+            if (!nextValue(value))
+                return false;
+            options.recordPath = value;
+        }
+        else if (arg == "--replay")
+        {
+            if (!nextValue(value))
+                return false;
+            options.replayPath = value;
+        }
+        else if (arg == "--fixed-dt")
+        {
+            if (!nextValue(value))
+                return false;
+            options.fixedDeltaTime = static_cast<float>(std::atof(value.c_str()));
+        }
+        else if (arg == "--gbuffer")
+        {
+            if (!nextValue(value))
+                return false;
+            if (value == "classic")
+                options.gBufferLayout = GBUFFER_CLASSIC;
+            else if (value == "depth")
+                options.gBufferLayout = GBUFFER_DEPTH_RECONSTRUCT;
+            else if (value == "packed")
+                options.gBufferLayout = GBUFFER_PACKED;
+            else
+            {
+                std::cout << "ERROR::OPTIONS::UNKNOWN_GBUFFER_LAYOUT: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "--lights")
+        {
+            if (!nextValue(value))
+                return false;
+            options.lightCount = std::atoi(value.c_str());
+        }
+        else if (arg == "--lighting")
+        {
+            if (!nextValue(value))
+                return false;
+            if (value == "quad")
+                options.lightingPath = LIGHTING_QUAD;
+            else if (value == "tiled")
+                options.lightingPath = LIGHTING_TILED;
+            else if (value == "clustered")
+                options.lightingPath = LIGHTING_CLUSTERED;
+            else if (value == "volumes")
+                options.lightingPath = LIGHTING_VOLUMES;
+            else
+            {
+                std::cout << "ERROR::OPTIONS::UNKNOWN_LIGHTING_PATH: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "--threads")
+        {
+            if (!nextValue(value))
+                return false;
+            options.threadCount = std::atoi(value.c_str());
+        }
+        else if (arg == "--shadows")
+        {
+            if (!nextValue(value))
+                return false;
+            if (value == "off")
+                options.shadowMode = SHADOWS_OFF;
+            else if (value == "full")
+                options.shadowMode = SHADOWS_FULL;
+            else if (value == "cached")
+                options.shadowMode = SHADOWS_CACHED;
+            else
+            {
+                std::cout << "ERROR::OPTIONS::UNKNOWN_SHADOW_MODE: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "--point-shadows")
+        {
+            if (!nextValue(value))
+                return false;
+            options.pointShadowCount = std::atoi(value.c_str());
+        }
+        else if (arg == "--shadow-atlas-mb")
+        {
+            if (!nextValue(value))
+                return false;
+            options.shadowAtlasMB = static_cast<float>(std::atof(value.c_str()));
+        }
+        else if (arg == "--static-lights")
+        {
+            options.staticLights = true;
+        }
+        else if (arg == "--instances")
+        {
+            if (!nextValue(value))
+                return false;
+            options.instanceCount = std::atoi(value.c_str());
+        }
+        else if (arg == "--light-queries")
+        {
+            options.lightQueries = true;
+        }
+        else if (arg == "--instance-ramp")
+        {
+            options.instanceRamp = true;
+        }
+        else if (arg == "--normal-matrix")
+        {
+            if (!nextValue(value))
+                return false;
+            if (value == "shader")
+                options.normalMatrixMode = NORMAL_MATRIX_SHADER;
+            else if (value == "precomputed")
+                options.normalMatrixMode = NORMAL_MATRIX_PRECOMPUTED;
+            else
+            {
+                std::cout << "ERROR::OPTIONS::UNKNOWN_NORMAL_MATRIX_MODE: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "--vertex-format")
+        {
+            if (!nextValue(value))
+                return false;
+            if (value == "float")
+                options.vertexFormat = VERTEX_FORMAT_FLOAT;
+            else if (value == "compressed")
+                options.vertexFormat = VERTEX_FORMAT_COMPRESSED;
+            else
+            {
+                std::cout << "ERROR::OPTIONS::UNKNOWN_VERTEX_FORMAT: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "--culling")
+        {
+            if (!nextValue(value))
+                return false;
+            if (value == "off")
+                options.cullingMode = CULLING_OFF;
+            else if (value == "frustum")
+                options.cullingMode = CULLING_FRUSTUM;
+            else if (value == "gpu")
+                options.cullingMode = CULLING_GPU;
+            else if (value == "hiz")
+                options.cullingMode = CULLING_HIZ;
+            else if (value == "software")
+                options.cullingMode = CULLING_SOFTWARE;
+            else if (value == "queries")
+                options.cullingMode = CULLING_QUERIES;
+            else
+            {
+                std::cout << "ERROR::OPTIONS::UNKNOWN_CULLING_MODE: " << value << std::endl;
+                return false;
+            }
+        }
+        else if (arg == "--lod")
+        {
+            options.lod = true;
+        }
+        else if (arg == "--lod-error")
+        {
+            if (!nextValue(value))
+                return false;
+            options.lodError = static_cast<float>(std::atof(value.c_str()));
+        }
+        else if (arg == "--lod-ramp")
+        {
+            options.lodRamp = true;
+        }
+        else if (arg == "--material-objects")
+        {
+            if (!nextValue(value))
+                return false;
+            options.materialObjects = std::atoi(value.c_str());
+        }
+        else if (arg == "--materials")
+        {
+            if (!nextValue(value))
+                return false;
+            options.materialCount = std::atoi(value.c_str());
+        }
+        else if (arg == "--render-queue")
+        {
+            options.renderQueue = true;
+        }
+        else if (arg == "--help" || arg == "-h")
+        {
+            PrintRenderOptionsUsage(argv[0]);
+            return false;
+        }
+        else
+        {
+            std::cout << "ERROR::OPTIONS::UNKNOWN_ARGUMENT: " << arg << std::endl;
+            PrintRenderOptionsUsage(argv[0]);
+            return false;
+        }
+    }
+
+    if (!options.recordPath.empty() && !options.replayPath.empty())
+    {
+        std::cout << "ERROR::OPTIONS::--record and --replay cannot be used together" << std::endl;
+        return false;
+    }
+    // 基准测试 (包括离屏模式) 由脚本化路径直接设置摄像机，没有可录制的输入
+    if (!options.recordPath.empty() && (options.benchmarkFrames > 0 || options.headless))
+    {
+        std::cout << "ERROR::OPTIONS::--record cannot be used with --frames or --headless" << std::endl;
+        return false;
+    }
+
+    // 离屏模式必须有帧数上限，否则永远不会退出
+    if (options.headless && options.benchmarkFrames <= 0)
+        options.benchmarkFrames = 600;
+    if (options.benchmarkFrames > 0 && options.gpuCsvPath.empty())
+        options.gpuCsvPath = "gpu_passes.csv";
+    return true;
+}
+
+#endif
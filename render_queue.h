@@ -0,0 +1,215 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "cpu_profiler.h"
+#include "mesh.h"
+#include "normal_matrix.h"
+#include "shader_m.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// 几何阶段的绘制队列
+// 每个单独绘制的物体提交一项，带一个 64 位排序键，从高位到低位依次是:
+//   pass (4 位) | 着色器 (8 位) | 材质纹理 (16 位) | VAO (12 位) | 深度 (24 位，由近到远)
+// 着色器/纹理/VAO 的 GL 名字在第一次出现时映射为紧凑的编号 (跨帧保持不变)。
+// 每帧按键做 LSD 基数排序 (每趟 8 位，某个字节所有键都相同时跳过这一趟)，执行时相同状态连续出现，
+// 与上一项相同的着色器/纹理/VAO 不再重复绑定；同一状态内由近到远，利于提前深度测试。
+// 不排序时按提交顺序执行，每项都重新绑定全部状态 (与原来逐物体内联绑定的做法一致)，便于对比。
+class RenderQueue
+{
+public:
+    static const int PassBits = 4;
+    static const int ShaderBits = 8;
+    static const int MaterialBits = 16;
+    static const int VaoBits = 12;
+    static const int DepthBits = 24;
+
+    struct Item
+    {
+        const Shader* Program;
+        unsigned int Texture;
+        unsigned int VAO;
+        const Mesh* Geometry;
+        glm::mat4 Model;
+    };
+
+    std::vector<Item> Items;
+
+    // 本帧统计 (状态切换 = 着色器、纹理、VAO 的绑定次数之和)
+    int FrameDraws = 0;
+    int FrameInlineChanges = 0;     // 提交顺序，每项都绑定全部状态
+    int FrameSubmissionChanges = 0; // 提交顺序，跳过冗余绑定
+    int FrameSortedChanges = 0;     // 排序后，跳过冗余绑定 (只在排序时统计)
+
+    // 累计
+    int Frames = 0;
+    int SortedFrames = 0;
+    long long Draws = 0;
+    long long InlineChanges = 0;
+    long long SubmissionChanges = 0;
+    long long SortedChanges = 0;
+    double SortMsTotal = 0.0;
+
+    // 每帧提交前调用: view 和近远平面用于计算深度键
+    void Begin(const glm::mat4& view, float nearPlane, float farPlane)
+    {
+        Items.clear();
+        keys.clear();
+        frameView = view;
+        frameNear = nearPlane;
+        frameFar = farPlane;
+    }
+
+    void Submit(const Shader& program, unsigned int texture, unsigned int vao, const Mesh& geometry, const glm::mat4& model,
+                uint32_t pass = 0)
+    {
+        float viewDepth = -(frameView * model[3]).z;
+        float depth = std::clamp((viewDepth - frameNear) / (frameFar - frameNear), 0.0f, 1.0f);
+        uint64_t key = field(pass, PassBits);
+        key = (key << ShaderBits) | field(denseId(shaderIds, program.ID), ShaderBits);
+        key = (key << MaterialBits) | field(denseId(textureIds, texture), MaterialBits);
+        key = (key << VaoBits) | field(denseId(vaoIds, vao), VaoBits);
+        key = (key << DepthBits) | static_cast<uint64_t>(depth * ((1u << DepthBits) - 1));
+        keys.push_back({ key, static_cast<uint32_t>(Items.size()) });
+        Items.push_back({ &program, texture, vao, &geometry, model });
+    }
+
+    // 执行本帧提交的全部绘制 (纹理固定绑定在单元 0)。sorted 为 false 时按提交顺序、每项都重新绑定
+    // precomputedNormals: 着色器为 PRECOMPUTED_NORMAL_MATRIX 变体，需要逐项上传法线矩阵
+    void Execute(bool sorted, bool precomputedNormals)
+    {
+        CPU_PROFILE_SCOPE("render_queue");
+        FrameDraws = static_cast<int>(Items.size());
+        FrameInlineChanges = FrameDraws * 3;
+        FrameSubmissionChanges = countChanges(false);
+        FrameSortedChanges = 0;
+        if (sorted)
+        {
+            auto start = std::chrono::steady_clock::now();
+            radixSort();
+            SortMsTotal += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            FrameSortedChanges = countChanges(true);
+            SortedChanges += FrameSortedChanges;
+            ++SortedFrames;
+        }
+        ++Frames;
+        Draws += FrameDraws;
+        InlineChanges += FrameInlineChanges;
+        SubmissionChanges += FrameSubmissionChanges;
+
+        glActiveTexture(GL_TEXTURE0);
+        const Shader* boundProgram = nullptr;
+        unsigned int boundTexture = 0, boundVAO = 0;
+        bool first = true;
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            const Item& item = Items[sorted ? keys[i].Item : i];
+            if (!sorted || first || item.Program->ID != boundProgram->ID)
+                item.Program->use();
+            if (!sorted || first || item.Texture != boundTexture)
+                glBindTexture(GL_TEXTURE_2D, item.Texture);
+            if (!sorted || first || item.VAO != boundVAO)
+                glBindVertexArray(item.VAO);
+            boundProgram = item.Program;
+            boundTexture = item.Texture;
+            boundVAO = item.VAO;
+            first = false;
+
+            item.Program->setMat4("model", item.Model);
+            item.Geometry->SetPositionUniforms(*item.Program);
+            if (precomputedNormals)
+                item.Program->setMat3("normalMatrix", ComputeNormalMatrix(item.Model));
+            item.Geometry->Draw();
+        }
+        glBindVertexArray(0);
+    }
+
+    void PrintSummary() const
+    {
+        if (Frames == 0 || Draws == 0)
+            return;
+        std::cout << "Render queue: avg " << Draws / Frames << " draws, state changes per frame: "
+                  << InlineChanges / Frames << " inline, " << SubmissionChanges / Frames << " in submission order";
+        if (SortedFrames > 0)
+            std::cout << ", " << SortedChanges / SortedFrames << " sorted (radix sort " << SortMsTotal / SortedFrames << " ms)";
+        std::cout << std::endl;
+    }
+
+private:
+    struct SortEntry
+    {
+        uint64_t Key;
+        uint32_t Item;
+    };
+
+    std::vector<SortEntry> keys, scratch;
+    std::vector<unsigned int> shaderIds, textureIds, vaoIds;
+    glm::mat4 frameView = glm::mat4(1.0f);
+    float frameNear = 0.1f, frameFar = 100.0f;
+
+    static uint64_t field(uint32_t value, int bits)
+    {
+        return static_cast<uint64_t>(value) & ((1ull << bits) - 1);
+    }
+
+    // GL 名字 -> 紧凑编号 (不同的状态只有几十个，线性查找即可)
+    static uint32_t denseId(std::vector<unsigned int>& table, unsigned int name)
+    {
+        auto found = std::find(table.begin(), table.end(), name);
+        if (found != table.end())
+            return static_cast<uint32_t>(found - table.begin());
+        table.push_back(name);
+        return static_cast<uint32_t>(table.size() - 1);
+    }
+
+    void radixSort()
+    {
+        size_t count = keys.size();
+        if (count < 2)
+            return;
+        scratch.resize(count);
+        for (int shift = 0; shift < 64; shift += 8)
+        {
+            size_t offsets[256] = {};
+            for (const SortEntry& entry : keys)
+                ++offsets[(entry.Key >> shift) & 0xFF];
+            if (offsets[(keys[0].Key >> shift) & 0xFF] == count)
+                continue; // 这个字节全部相同，顺序不变
+            size_t sum = 0;
+            for (size_t& offset : offsets)
+            {
+                size_t bucket = offset;
+                offset = sum;
+                sum += bucket;
+            }
+            for (const SortEntry& entry : keys)
+                scratch[offsets[(entry.Key >> shift) & 0xFF]++] = entry;
+            keys.swap(scratch);
+        }
+    }
+
+    // 在给定顺序下跳过冗余绑定时的状态切换次数
+    int countChanges(bool sorted) const
+    {
+        int changes = 0;
+        const Item* previous = nullptr;
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            const Item& item = Items[sorted ? keys[i].Item : i];
+            changes += !previous || item.Program->ID != previous->Program->ID;
+            changes += !previous || item.Texture != previous->Texture;
+            changes += !previous || item.VAO != previous->VAO;
+            previous = &item;
+        }
+        return changes;
+    }
+};
+
+#endif
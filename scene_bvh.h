@@ -0,0 +1,471 @@
+#ifndef SCENE_BVH_H
+#define SCENE_BVH_H
+
+#include <glm/glm.hpp>
+
+#include "cpu_profiler.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+struct Aabb
+{
+    glm::vec3 Min = glm::vec3(1e30f);
+    glm::vec3 Max = glm::vec3(-1e30f);
+
+    void Expand(const Aabb& other)
+    {
+        Min = glm::min(Min, other.Min);
+        Max = glm::max(Max, other.Max);
+    }
+    glm::vec3 Center() const { return (Min + Max) * 0.5f; }
+    float SurfaceArea() const
+    {
+        glm::vec3 d = glm::max(Max - Min, glm::vec3(0.0f));
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+
+    // 变换后的包围盒: 中心按矩阵变换，半长乘以 |M| (Arvo)
+    static Aabb Transform(const Aabb& box, const glm::mat4& m)
+    {
+        glm::vec3 center = glm::vec3(m * glm::vec4(box.Center(), 1.0f));
+        glm::vec3 extent = (box.Max - box.Min) * 0.5f;
+        glm::vec3 worldExtent(0.0f);
+        for (int column = 0; column < 3; ++column)
+            worldExtent += glm::abs(glm::vec3(m[column])) * extent[column];
+        return { center - worldExtent, center + worldExtent };
+    }
+};
+
+// 视锥体的 6 个平面 (法线朝内，dot(n, p) + d >= 0 为内侧)
+struct Frustum
+{
+    glm::vec4 Planes[6];
+
+    // 从 projection * view 提取 (Gribb & Hartmann): 各平面是矩阵第 4 行与第 1..3 行的和/差
+    static Frustum FromMatrix(const glm::mat4& viewProjection)
+    {
+        glm::vec4 row[4];
+        for (int i = 0; i < 4; ++i)
+            row[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+        Frustum frustum;
+        frustum.Planes[0] = row[3] + row[0]; // 左
+        frustum.Planes[1] = row[3] - row[0]; // 右
+        frustum.Planes[2] = row[3] + row[1]; // 下
+        frustum.Planes[3] = row[3] - row[1]; // 上
+        frustum.Planes[4] = row[3] + row[2]; // 近
+        frustum.Planes[5] = row[3] - row[2]; // 远
+        for (glm::vec4& plane : frustum.Planes)
+            plane /= glm::length(glm::vec3(plane));
+        return frustum;
+    }
+
+    // 包围盒与视锥体可能相交 (保守): 没有任何平面把它完全排除在外侧
+    bool Intersects(const Aabb& box) const
+    {
+        glm::vec3 center = box.Center();
+        glm::vec3 extent = (box.Max - box.Min) * 0.5f;
+        for (const glm::vec4& plane : Planes)
+        {
+            glm::vec3 normal(plane);
+            if (glm::dot(normal, center) + plane.w < -glm::dot(glm::abs(normal), extent))
+                return false;
+        }
+        return true;
+    }
+};
+
+// 场景物体的层次包围盒 (BVH)
+// 构建: 按质心最长轴分桶的 SAH，物体下标原地划分，所以每个节点 (包括内部节点) 覆盖 objectOrder 中连续的一段。
+// 运动物体: UpdateObject 只沿叶节点向上重算祖先的包围盒，包围盒不再变化时停止 (增量 refit，拓扑不变)。
+// 剔除: 先在主线程把树的上层展开成若干子树，再由线程池并行遍历；节点与 6 个平面的测试用 SSE 一次算 4 个平面。
+// 节点完全在视锥体内时整段物体直接输出，不再测试子节点。子树按深度优先顺序排列并按此顺序拼接，
+// 所以输出的可见列表与串行遍历的顺序相同，与线程数无关。
+class SceneBvh
+{
+public:
+    static const int BinCount = 12;     // SAH 分桶数
+    static const int MaxLeafObjects = 4; // 不超过此数量总是成为叶节点；SAH 认为不值得划分时叶节点最多两倍于此
+    static const int TasksPerThread = 4; // 并行遍历时每个线程大约分到的子树数
+
+    struct Node
+    {
+        Aabb Bounds;
+        int Left = -1;  // 内部节点: 左子节点 (右子节点 = Left + 1)；叶节点为 -1
+        int First = 0;  // 覆盖 objectOrder 中 [First, First + Count) 的物体
+        int Count = 0;
+    };
+    std::vector<Node> Nodes;
+
+    // 统计
+    double BuildMs = 0.0;
+    int Depth = 0;
+    int Frames = 0;
+    long long VisibleTotal = 0;
+    long long NodesTestedTotal = 0;
+    double CullMsTotal = 0.0;
+    int Refits = 0;
+
+    int ObjectCount() const { return static_cast<int>(objectBounds.size()); }
+    const Aabb& ObjectBounds(int object) const { return objectBounds[object]; }
+
+    void Build(const std::vector<Aabb>& bounds)
+    {
+        auto start = std::chrono::steady_clock::now();
+        objectBounds = bounds;
+        int count = ObjectCount();
+        objectOrder.resize(count);
+        for (int i = 0; i < count; ++i)
+            objectOrder[i] = static_cast<uint32_t>(i);
+        centroids.resize(count);
+        for (int i = 0; i < count; ++i)
+            centroids[i] = bounds[i].Center();
+        objectLeaf.assign(count, 0);
+
+        Nodes.clear();
+        Nodes.reserve(static_cast<size_t>(std::max(count, 1)) * 2);
+        parents.clear();
+        Depth = 0;
+        Nodes.push_back(Node());
+        parents.push_back(-1);
+        Nodes[0].First = 0;
+        Nodes[0].Count = count;
+        subdivide(0, 1);
+        BuildMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // 运动物体的新包围盒，沿父节点向上重算
+    void UpdateObject(int object, const Aabb& bounds)
+    {
+        objectBounds[object] = bounds;
+        for (int node = objectLeaf[object]; node >= 0; node = parents[node])
+        {
+            Aabb previous = Nodes[node].Bounds;
+            computeBounds(node);
+            ++Refits;
+            if (previous.Min == Nodes[node].Bounds.Min && previous.Max == Nodes[node].Bounds.Max)
+                break;
+        }
+    }
+
+    // 视锥体剔除，可见物体的下标写入 visible (覆盖原内容)
+    void Cull(const Frustum& frustum, ThreadPool& pool, std::vector<uint32_t>& visible)
+    {
+        CPU_PROFILE_SCOPE("frustum_cull");
+        auto start = std::chrono::steady_clock::now();
+        visible.clear();
+        PlaneSet planes(frustum);
+        long long tested = 0;
+
+        // 逐层展开上层节点，直到子树数量足够分给全部线程。每个节点原地替换为它的左右子节点，
+        // 所以 tasks 始终保持深度优先顺序，按任务拼接的结果与串行遍历一致 (与线程数无关)
+        struct Task
+        {
+            int Node;
+            bool Inside; // 已知完全在视锥体内
+            bool Final;  // 已测试过，不再展开
+        };
+        std::vector<Task> tasks, next;
+        if (!Nodes.empty() && ObjectCount() > 0)
+            tasks.push_back({ 0, false, false });
+        size_t target = static_cast<size_t>(pool.ThreadCount()) * TasksPerThread;
+        bool expandable = !tasks.empty();
+        while (expandable && tasks.size() < target)
+        {
+            expandable = false;
+            next.clear();
+            for (const Task& task : tasks)
+            {
+                if (task.Final)
+                {
+                    next.push_back(task);
+                    continue;
+                }
+                const Node& node = Nodes[task.Node];
+                int result = planes.Test(node.Bounds);
+                ++tested;
+                if (result == Outside)
+                    continue;
+                if (result == Inside || node.Left < 0)
+                    next.push_back({ task.Node, result == Inside, true });
+                else
+                {
+                    next.push_back({ node.Left, false, false });
+                    next.push_back({ node.Left + 1, false, false });
+                    expandable = true;
+                }
+            }
+            tasks.swap(next);
+        }
+
+        taskVisible.resize(tasks.size());
+        taskTested.assign(tasks.size(), 0);
+        pool.ParallelFor(static_cast<int>(tasks.size()), [&](int task) {
+            taskVisible[task].clear();
+            taskTested[task] = traverse(tasks[task].Node, tasks[task].Inside, planes, taskVisible[task]);
+        });
+        for (size_t task = 0; task < tasks.size(); ++task)
+        {
+            visible.insert(visible.end(), taskVisible[task].begin(), taskVisible[task].end());
+            tested += taskTested[task];
+        }
+
+        ++Frames;
+        VisibleTotal += static_cast<long long>(visible.size());
+        NodesTestedTotal += tested;
+        CullMsTotal += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void PrintSummary() const
+    {
+        if (Frames == 0)
+            return;
+        std::cout << "Frustum culling: avg " << static_cast<double>(VisibleTotal) / Frames << " of " << ObjectCount()
+                  << " objects visible, " << static_cast<double>(NodesTestedTotal) / Frames << " of " << Nodes.size()
+                  << " nodes tested, " << CullMsTotal / Frames << " ms/frame, " << Refits << " node refits" << std::endl;
+    }
+
+private:
+    enum TestResult { Outside, Intersect, Inside };
+
+    std::vector<Aabb> objectBounds;
+    std::vector<glm::vec3> centroids;
+    std::vector<uint32_t> objectOrder;
+    std::vector<int> objectLeaf; // 物体所在的叶节点
+    std::vector<int> parents;
+    std::vector<std::vector<uint32_t>> taskVisible;
+    std::vector<long long> taskTested;
+
+    // 6 个平面补齐到 8 个 (多出的平面恒为内侧)，SoA 布局，每次测试 4 个平面
+    struct PlaneSet
+    {
+        alignas(16) float Nx[8], Ny[8], Nz[8], D[8];
+        alignas(16) float Ax[8], Ay[8], Az[8]; // |n|
+
+        explicit PlaneSet(const Frustum& frustum)
+        {
+            for (int i = 0; i < 8; ++i)
+            {
+                glm::vec4 p = i < 6 ? frustum.Planes[i] : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+                Nx[i] = p.x; Ny[i] = p.y; Nz[i] = p.z; D[i] = p.w;
+                Ax[i] = std::abs(p.x); Ay[i] = std::abs(p.y); Az[i] = std::abs(p.z);
+            }
+        }
+
+        // 中心到平面的距离 ± 半长在法线上的投影: 最远点在外侧则整个盒子在外，最近点在内侧则完全在内
+        int Test(const Aabb& box) const
+        {
+            glm::vec3 c = box.Center();
+            glm::vec3 e = (box.Max - box.Min) * 0.5f;
+#if defined(__SSE2__) || defined(_M_X64)
+            __m128 cx = _mm_set1_ps(c.x), cy = _mm_set1_ps(c.y), cz = _mm_set1_ps(c.z);
+            __m128 ex = _mm_set1_ps(e.x), ey = _mm_set1_ps(e.y), ez = _mm_set1_ps(e.z);
+            int outside = 0, partial = 0;
+            for (int i = 0; i < 8; i += 4)
+            {
+                __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(Nx + i), cx), _mm_mul_ps(_mm_load_ps(Ny + i), cy)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_load_ps(Nz + i), cz), _mm_load_ps(D + i)));
+                __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(Ax + i), ex), _mm_mul_ps(_mm_load_ps(Ay + i), ey)),
+                                           _mm_mul_ps(_mm_load_ps(Az + i), ez));
+                outside |= _mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(dist, radius), _mm_setzero_ps()));
+                partial |= _mm_movemask_ps(_mm_cmplt_ps(_mm_sub_ps(dist, radius), _mm_setzero_ps()));
+            }
+            if (outside)
+                return Outside;
+            return partial ? Intersect : Inside;
+#else
+            bool partial = false;
+            for (int i = 0; i < 6; ++i)
+            {
+                float dist = Nx[i] * c.x + Ny[i] * c.y + Nz[i] * c.z + D[i];
+                float radius = Ax[i] * e.x + Ay[i] * e.y + Az[i] * e.z;
+                if (dist + radius < 0.0f)
+                    return Outside;
+                partial = partial || dist - radius < 0.0f;
+            }
+            return partial ? Intersect : Inside;
+#endif
+        }
+    };
+
+    void computeBounds(int index)
+    {
+        Node& node = Nodes[index];
+        node.Bounds = Aabb();
+        if (node.Left < 0)
+        {
+            for (int i = node.First; i < node.First + node.Count; ++i)
+                node.Bounds.Expand(objectBounds[objectOrder[i]]);
+        }
+        else
+        {
+            node.Bounds.Expand(Nodes[node.Left].Bounds);
+            node.Bounds.Expand(Nodes[node.Left + 1].Bounds);
+        }
+    }
+
+    void makeLeaf(int index)
+    {
+        Nodes[index].Left = -1;
+        computeBounds(index);
+        for (int i = Nodes[index].First; i < Nodes[index].First + Nodes[index].Count; ++i)
+            objectLeaf[objectOrder[i]] = index;
+    }
+
+    void subdivide(int index, int depth)
+    {
+        Depth = std::max(Depth, depth);
+        int first = Nodes[index].First, count = Nodes[index].Count;
+        if (count <= MaxLeafObjects)
+        {
+            makeLeaf(index);
+            return;
+        }
+
+        // 质心包围盒的最长轴上分桶
+        Aabb centroidBounds;
+        Aabb bounds;
+        for (int i = first; i < first + count; ++i)
+        {
+            centroidBounds.Expand({ centroids[objectOrder[i]], centroids[objectOrder[i]] });
+            bounds.Expand(objectBounds[objectOrder[i]]);
+        }
+        glm::vec3 extent = centroidBounds.Max - centroidBounds.Min;
+        int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+        if (extent[axis] <= 0.0f)
+        {
+            makeLeaf(index); // 质心全部重合，无法划分
+            return;
+        }
+
+        struct Bin { Aabb Bounds; int Count = 0; };
+        Bin bins[BinCount];
+        float scale = BinCount / extent[axis];
+        auto binOf = [&](uint32_t object) {
+            int bin = static_cast<int>((centroids[object][axis] - centroidBounds.Min[axis]) * scale);
+            return std::min(bin, BinCount - 1);
+        };
+        for (int i = first; i < first + count; ++i)
+        {
+            Bin& bin = bins[binOf(objectOrder[i])];
+            bin.Bounds.Expand(objectBounds[objectOrder[i]]);
+            ++bin.Count;
+        }
+
+        // 从两端累积，代价 = 左面积 * 左数量 + 右面积 * 右数量 (相对父节点面积，遍历代价记为 1)
+        float leftArea[BinCount - 1], rightArea[BinCount - 1];
+        int leftCount[BinCount - 1], rightCount[BinCount - 1];
+        Aabb accumulated;
+        int accumulatedCount = 0;
+        for (int i = 0; i < BinCount - 1; ++i)
+        {
+            accumulated.Expand(bins[i].Bounds);
+            accumulatedCount += bins[i].Count;
+            leftArea[i] = accumulatedCount ? accumulated.SurfaceArea() : 0.0f;
+            leftCount[i] = accumulatedCount;
+        }
+        accumulated = Aabb();
+        accumulatedCount = 0;
+        for (int i = BinCount - 1; i > 0; --i)
+        {
+            accumulated.Expand(bins[i].Bounds);
+            accumulatedCount += bins[i].Count;
+            rightArea[i - 1] = accumulatedCount ? accumulated.SurfaceArea() : 0.0f;
+            rightCount[i - 1] = accumulatedCount;
+        }
+        int bestSplit = -1;
+        float bestCost = 1e30f;
+        for (int i = 0; i < BinCount - 1; ++i)
+        {
+            if (leftCount[i] == 0 || rightCount[i] == 0)
+                continue;
+            float cost = leftArea[i] * leftCount[i] + rightArea[i] * rightCount[i];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestSplit = i;
+            }
+        }
+        float parentArea = bounds.SurfaceArea();
+        float leafCost = static_cast<float>(count);
+        if (bestSplit < 0 || (parentArea > 0.0f && 1.0f + bestCost / parentArea >= leafCost && count <= MaxLeafObjects * 2))
+        {
+            makeLeaf(index);
+            return;
+        }
+
+        int middle = static_cast<int>(std::partition(objectOrder.begin() + first, objectOrder.begin() + first + count,
+                                                     [&](uint32_t object) { return binOf(object) <= bestSplit; }) -
+                                      objectOrder.begin());
+        int left = static_cast<int>(Nodes.size());
+        Nodes.push_back(Node());
+        Nodes.push_back(Node());
+        parents.push_back(index);
+        parents.push_back(index);
+        Nodes[left].First = first;
+        Nodes[left].Count = middle - first;
+        Nodes[left + 1].First = middle;
+        Nodes[left + 1].Count = first + count - middle;
+        Nodes[index].Left = left;
+        subdivide(left, depth + 1);
+        subdivide(left + 1, depth + 1);
+        computeBounds(index);
+    }
+
+    // 子树遍历 (显式栈)，返回测试过的节点数
+    long long traverse(int root, bool rootInside, const PlaneSet& planes, std::vector<uint32_t>& out) const
+    {
+        if (rootInside)
+        {
+            emit(root, out);
+            return 0;
+        }
+        long long tested = 0;
+        std::vector<int> stack;
+        stack.reserve(64);
+        stack.push_back(root);
+        while (!stack.empty())
+        {
+            int index = stack.back();
+            stack.pop_back();
+            const Node& node = Nodes[index];
+            int result = planes.Test(node.Bounds);
+            ++tested;
+            if (result == Outside)
+                continue;
+            if (result == Inside || node.Left < 0)
+            {
+                if (node.Left < 0 && result == Intersect)
+                {
+                    // 叶节点与视锥体相交: 逐个物体测试
+                    for (int i = node.First; i < node.First + node.Count; ++i)
+                        if (planes.Test(objectBounds[objectOrder[i]]) != Outside)
+                            out.push_back(objectOrder[i]);
+                    continue;
+                }
+                emit(index, out);
+                continue;
+            }
+            stack.push_back(node.Left + 1);
+            stack.push_back(node.Left);
+        }
+        return tested;
+    }
+
+    void emit(int index, std::vector<uint32_t>& out) const
+    {
+        const Node& node = Nodes[index];
+        out.insert(out.end(), objectOrder.begin() + node.First, objectOrder.begin() + node.First + node.Count);
+    }
+};
+
+#endif
@@ -5,6 +5,8 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp> // 包含 glm::value_ptr
 
+#include "cpu_profiler.h"
+
 #include <string>
 #include <fstream>
 #include <sstream>
@@ -13,11 +15,16 @@
 class Shader
 {
 public:
-    // 程序ID
-    unsigned int ID;
+    // 程序ID (0 表示无效的着色器程序)
+    unsigned int ID = 0;
+
+    // 空着色器，之后用 Shader::Compute 等工厂函数赋值
+    Shader() {}
 
     // 构造函数读取并构建着色器
-    Shader(const char* vertexPath, const char* fragmentPath)
+    // defines: 可选的预处理定义 (例如 "#define FOO\n")，插入到两个着色器的 #version 行之后，
+    // 用于从同一份源文件编译出不同的变体
+    Shader(const char* vertexPath, const char* fragmentPath, const std::string& defines = "")
     {
         // 1. 从文件路径中获取顶点/片段着色器源代码
         std::string vertexCode;
@@ -58,6 +65,11 @@ public:
             // 转换数据流到string
             vertexCode   = vShaderStream.str();
             fragmentCode = fShaderStream.str();
+            if (!defines.empty())
+            {
+                vertexCode   = injectDefines(vertexCode, defines);
+                fragmentCode = injectDefines(fragmentCode, defines);
+            }
             
             // 检查着色器代码是否为空
             if (vertexCode.empty()) {
@@ -133,12 +145,101 @@ public:
         glDeleteShader(fragment);
     }
 
+    // 构建计算着色器程序 (需要 GL 4.3)
+    // 与上面的构造函数不同，编译或链接失败时返回 ID 为 0 的着色器，调用方可以据此回退到其他渲染路径
+    static Shader Compute(const char* computePath, const std::string& defines = "")
+    {
+        Shader shader;
+        std::ifstream cShaderFile(computePath);
+        if (!cShaderFile.good())
+        {
+            std::cout << "ERROR::SHADER::COMPUTE_FILE_NOT_FOUND: " << computePath << std::endl;
+            return shader;
+        }
+        std::stringstream cShaderStream;
+        cShaderStream << cShaderFile.rdbuf();
+        std::string computeCode = cShaderStream.str();
+        if (!defines.empty())
+            computeCode = injectDefines(computeCode, defines);
+        const char* cShaderCode = computeCode.c_str();
+
+        unsigned int compute = glCreateShader(GL_COMPUTE_SHADER);
+        glShaderSource(compute, 1, &cShaderCode, NULL);
+        glCompileShader(compute);
+        shader.checkCompileErrors(compute, "COMPUTE");
+
+        shader.ID = glCreateProgram();
+        glAttachShader(shader.ID, compute);
+        glLinkProgram(shader.ID);
+        shader.checkCompileErrors(shader.ID, "PROGRAM");
+        glDeleteShader(compute);
+
+        GLint success;
+        glGetProgramiv(shader.ID, GL_LINK_STATUS, &success);
+        if (!success)
+        {
+            glDeleteProgram(shader.ID);
+            shader.ID = 0;
+        }
+        return shader;
+    }
+
+    // 构建带几何着色器的程序 (例如分层渲染时由几何着色器设置 gl_Layer)
+    // 与 Compute 相同，编译或链接失败时返回 ID 为 0 的着色器
+    static Shader WithGeometry(const char* vertexPath, const char* geometryPath, const char* fragmentPath, const std::string& defines = "")
+    {
+        Shader shader;
+        const char* paths[3] = { vertexPath, geometryPath, fragmentPath };
+        const GLenum stages[3] = { GL_VERTEX_SHADER, GL_GEOMETRY_SHADER, GL_FRAGMENT_SHADER };
+        const char* stageNames[3] = { "VERTEX", "GEOMETRY", "FRAGMENT" };
+        unsigned int shaders[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            std::ifstream file(paths[i]);
+            if (!file.good())
+            {
+                std::cout << "ERROR::SHADER::" << stageNames[i] << "_FILE_NOT_FOUND: " << paths[i] << std::endl;
+                for (int j = 0; j < i; ++j)
+                    glDeleteShader(shaders[j]);
+                return shader;
+            }
+            std::stringstream stream;
+            stream << file.rdbuf();
+            std::string code = stream.str();
+            if (!defines.empty())
+                code = injectDefines(code, defines);
+            const char* source = code.c_str();
+            shaders[i] = glCreateShader(stages[i]);
+            glShaderSource(shaders[i], 1, &source, NULL);
+            glCompileShader(shaders[i]);
+            shader.checkCompileErrors(shaders[i], stageNames[i]);
+        }
+
+        shader.ID = glCreateProgram();
+        for (int i = 0; i < 3; ++i)
+            glAttachShader(shader.ID, shaders[i]);
+        glLinkProgram(shader.ID);
+        shader.checkCompileErrors(shader.ID, "PROGRAM");
+        for (int i = 0; i < 3; ++i)
+            glDeleteShader(shaders[i]);
+
+        GLint success;
+        glGetProgramiv(shader.ID, GL_LINK_STATUS, &success);
+        if (!success)
+        {
+            glDeleteProgram(shader.ID);
+            shader.ID = 0;
+        }
+        return shader;
+    }
+
     // 激活着色器
     // 使用此着色器程序进行渲染
     // glUseProgram()函数将当前渲染状态设置为使用此着色器程序
     // 后续的渲染调用将使用此着色器程序中定义的顶点和片段处理逻辑
     void use() const
     { 
+        CPU_PROFILE_SCOPE("Shader::use");
         glUseProgram(ID); 
     }
 
@@ -212,6 +313,7 @@ public:
     // 用于将模型、视图或投影矩阵等变换矩阵传递给着色器
     void setMat4(const std::string &name, const glm::mat4 &mat) const
     {
+        CPU_PROFILE_SCOPE("Shader::setMat4");
         // 将4x4矩阵传递给着色器程序中的uniform变量
         // glGetUniformLocation: 获取着色器程序中指定名称的uniform变量的位置索引
         //   - ID: 着色器程序的ID
@@ -226,6 +328,26 @@ public:
     }
 
 private:
+    // 把预处理定义插入到 #version 行及紧随其后的 #extension 行之后
+    // (#version 必须是第一条预处理指令，#extension 必须出现在任何声明之前，定义中可能带有 uniform 声明)
+    static std::string injectDefines(const std::string& code, const std::string& defines)
+    {
+        size_t version = code.find("#version");
+        if (version == std::string::npos)
+            return defines + code;
+        size_t lineEnd = code.find('\n', version);
+        if (lineEnd == std::string::npos)
+            return code + "\n" + defines;
+        while (code.compare(lineEnd + 1, 10, "#extension") == 0)
+        {
+            size_t next = code.find('\n', lineEnd + 1);
+            if (next == std::string::npos)
+                return code + "\n" + defines;
+            lineEnd = next;
+        }
+        return code.substr(0, lineEnd + 1) + defines + code.substr(lineEnd + 1);
+    }
+
     // 用于检查着色器编译/链接错误的工具函数
     void checkCompileErrors(GLuint shader, std::string type)
     {
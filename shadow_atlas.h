@@ -0,0 +1,99 @@
+#ifndef SHADOW_ATLAS_H
+#define SHADOW_ATLAS_H
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <vector>
+
+// 阴影图集的四叉树分配器
+// 图集由若干 RootSize x RootSize 的根节点排成网格 (图集边长不必是 2 的幂)，每个根节点是一棵四叉树:
+// 请求的尺寸都是 2 的幂，节点大于请求时一分为四，递归到大小正好的空闲节点。
+// 分配结果每帧重新计算 (Reset 后按优先级依次 Allocate)，按尺寸从大到小分配时不会产生碎片。
+class ShadowAtlasAllocator
+{
+public:
+    // atlasSize: 图集边长 (RootSize 的整数倍), rootSize: 根节点边长 (2 的幂，即允许的最大分配尺寸)
+    void Init(int atlasSize, int rootSize)
+    {
+        AtlasSize = atlasSize;
+        RootSize = rootSize;
+        Reset();
+    }
+
+    // 清空全部分配
+    void Reset()
+    {
+        nodes.clear();
+        roots.clear();
+        UsedTexels = 0;
+        int grid = AtlasSize / RootSize;
+        for (int y = 0; y < grid; ++y)
+            for (int x = 0; x < grid; ++x)
+            {
+                roots.push_back(static_cast<int>(nodes.size()));
+                nodes.push_back({ glm::ivec2(x, y) * RootSize, RootSize, Free, -1 });
+            }
+    }
+
+    // 分配 size x size 的方块，成功时返回左下角的 texel 坐标，失败时返回 (-1, -1)
+    glm::ivec2 Allocate(int size)
+    {
+        for (int root : roots)
+        {
+            glm::ivec2 origin;
+            if (allocate(root, size, origin))
+            {
+                UsedTexels += static_cast<long long>(size) * size;
+                return origin;
+            }
+        }
+        return glm::ivec2(-1);
+    }
+
+    int AtlasSize = 0;
+    int RootSize = 0;
+    long long UsedTexels = 0;
+
+private:
+    enum State { Free, Split, Used };
+    struct Node
+    {
+        glm::ivec2 Origin;
+        int Size;
+        State NodeState;
+        int FirstChild; // Split 时 4 个子节点在 nodes 中连续存放
+    };
+    std::vector<Node> nodes;
+    std::vector<int> roots;
+
+    bool allocate(int index, int size, glm::ivec2& origin)
+    {
+        // nodes 可能在递归中扩容，不能持有引用
+        if (nodes[index].NodeState == Used || nodes[index].Size < size)
+            return false;
+        if (nodes[index].NodeState == Free)
+        {
+            if (nodes[index].Size == size)
+            {
+                nodes[index].NodeState = Used;
+                origin = nodes[index].Origin;
+                return true;
+            }
+            int half = nodes[index].Size / 2;
+            glm::ivec2 base = nodes[index].Origin;
+            nodes[index].NodeState = Split;
+            nodes[index].FirstChild = static_cast<int>(nodes.size());
+            nodes.push_back({ base, half, Free, -1 });
+            nodes.push_back({ base + glm::ivec2(half, 0), half, Free, -1 });
+            nodes.push_back({ base + glm::ivec2(0, half), half, Free, -1 });
+            nodes.push_back({ base + glm::ivec2(half, half), half, Free, -1 });
+        }
+        for (int child = 0; child < 4; ++child)
+            if (allocate(nodes[index].FirstChild + child, size, origin))
+                return true;
+        return false;
+    }
+};
+
+#endif
@@ -0,0 +1,6 @@
+#version 330 core
+// 只写深度，没有颜色输出
+
+void main()
+{
+}
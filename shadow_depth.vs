@@ -0,0 +1,15 @@
+#version 330 core
+// 阴影贴图深度通道: 只需要位置 (与立方体 VAO 的属性 0 一致)
+layout (location = 0) in vec3 aPos;
+
+#ifndef VERTEX_POSITION
+#define VERTEX_POSITION(p) (p) // 位置未量化 (量化时由 vertex_format.h 生成的定义给出反量化)
+#endif
+
+uniform mat4 lightSpaceMatrix; // 方向光的正交投影 * 光源视图
+uniform mat4 model;
+
+void main()
+{
+    gl_Position = lightSpaceMatrix * model * vec4(VERTEX_POSITION(aPos), 1.0);
+}
@@ -0,0 +1,397 @@
+#ifndef SOFTWARE_OCCLUSION_H
+#define SOFTWARE_OCCLUSION_H
+
+#include <glm/glm.hpp>
+
+#include "cpu_profiler.h"
+#include "mesh.h"
+#include "scene_bvh.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+// CPU 软件光栅化的遮挡剔除
+// 每帧从视锥体剔除后的可见物体中选出屏幕上最大的 MaxOccluders 个作为遮挡物，把它们的三角形
+// (按位置焊接后的低模网格) 光栅化到低分辨率的深度缓冲中，再用各可见物体包围盒的屏幕矩形和最近深度做测试，
+// 被完全挡住的物体从可见列表中去掉，几何阶段不会再提交它们。
+// - 光栅化按行带 (BandRows 行) 分给线程池，各带只写自己的行，不需要同步；
+//   每行按 SIMD 宽度 (AVX 8 / SSE 4 像素) 一次计算 3 条边函数得到覆盖掩码，深度取最小值后按掩码写回。
+// - 每个 TileSize x TileSize 的块另存最大深度，测试时整块都比物体近的直接跳过，只有不确定的块才逐像素比较。
+// - 遮挡物按像素中心采样，低分辨率下轮廓处最多多覆盖半个像素；测试时物体的屏幕矩形向外扩一个像素抵消。
+// 深度与 GPU 相同，为 NDC z 映射到 [0, 1] 后的值 (屏幕空间线性插值)。
+class SoftwareOcclusion
+{
+public:
+    static const int Width = 256;        // 深度缓冲宽度 (高度按屏幕宽高比，取整到 BandRows 的倍数)
+    static const int TileSize = 8;       // 块最大深度的粒度
+    static const int BandRows = 16;      // 每个光栅化任务处理的行数 (TileSize 的倍数)
+    static const int MaxOccluders = 256; // 每帧最多的遮挡物数
+    constexpr static float MinOccluderArea = 16.0f; // 屏幕矩形小于此面积 (深度缓冲像素) 的物体不作为遮挡物
+
+    int Height = 0;
+    std::vector<float> Depth;        // Width x Height，第 0 行在屏幕底部
+    std::vector<float> TileMaxDepth; // (Width / TileSize) x (Height / TileSize)
+
+    // 统计
+    int Frames = 0;
+    long long OccludersTotal = 0;
+    long long TrianglesTotal = 0; // 近平面裁剪后光栅化的三角形数
+    long long TestedTotal = 0;
+    long long OccludedTotal = 0;
+    double RasterMsTotal = 0.0;
+    double TestMsTotal = 0.0;
+
+    // mesh: 所有物体共用的网格 (只读取位置)；screenWidth/Height 决定深度缓冲的宽高比
+    void Create(const Mesh& mesh, int screenWidth, int screenHeight)
+    {
+        Height = static_cast<int>(std::ceil(static_cast<float>(Width) * screenHeight / std::max(screenWidth, 1) / BandRows)) * BandRows;
+        Height = std::max(Height, BandRows);
+        Depth.assign(static_cast<size_t>(Width) * Height, 1.0f);
+        TileMaxDepth.assign(static_cast<size_t>(Width / TileSize) * (Height / TileSize), 1.0f);
+
+        // 只保留位置并焊接 (立方体 24 -> 8 个顶点)，每个遮挡物只需变换这些顶点
+        positions.clear();
+        indices.clear();
+        std::vector<int> remap(mesh.VertexCount());
+        for (int v = 0; v < mesh.VertexCount(); ++v)
+        {
+            const float* p = &mesh.Vertices[static_cast<size_t>(v) * mesh.FloatsPerVertex];
+            glm::vec3 position(p[0], p[1], p[2]);
+            auto found = std::find(positions.begin(), positions.end(), position);
+            remap[v] = static_cast<int>(found - positions.begin());
+            if (found == positions.end())
+                positions.push_back(position);
+        }
+        for (uint32_t index : mesh.Indices)
+            indices.push_back(remap[index]);
+    }
+
+    // visible: 视锥体剔除后的物体列表，就地去掉被遮挡的物体 (保持原有顺序)
+    // objectModel: 物体下标 -> 模型矩阵 (变换遮挡物网格)；包围盒取自 BVH
+    void Cull(const glm::mat4& viewProjection, const SceneBvh& bvh, const std::function<glm::mat4(uint32_t)>& objectModel,
+              ThreadPool& pool, std::vector<uint32_t>& visible)
+    {
+        CPU_PROFILE_SCOPE("software_occlusion");
+        auto start = std::chrono::steady_clock::now();
+        int count = static_cast<int>(visible.size());
+        screenBounds.resize(count);
+        int chunks = std::max(1, std::min(count / 256, static_cast<int>(pool.ThreadCount()) * 4));
+        pool.ParallelFor(chunks, [&](int chunk) {
+            for (int i = count * chunk / chunks; i < count * (chunk + 1) / chunks; ++i)
+                screenBounds[i] = project(bvh.ObjectBounds(visible[i]), viewProjection);
+        });
+
+        selectOccluders(count);
+        buildTriangles(viewProjection, visible, objectModel);
+        int bands = Height / BandRows;
+        pool.ParallelFor(bands, [&](int band) { rasterizeBand(band); });
+        auto rasterized = std::chrono::steady_clock::now();
+
+        // 测试: 各块独立写 occluded 标志，之后按原顺序压缩
+        occluded.assign(count, 0);
+        pool.ParallelFor(chunks, [&](int chunk) {
+            for (int i = count * chunk / chunks; i < count * (chunk + 1) / chunks; ++i)
+                occluded[i] = isOccluded(screenBounds[i]) ? 1 : 0;
+        });
+        int kept = 0;
+        for (int i = 0; i < count; ++i)
+            if (!occluded[i])
+                visible[kept++] = visible[i];
+        visible.resize(kept);
+
+        auto end = std::chrono::steady_clock::now();
+        ++Frames;
+        OccludersTotal += static_cast<long long>(occluders.size());
+        TrianglesTotal += static_cast<long long>(triangles.size());
+        TestedTotal += count;
+        OccludedTotal += count - kept;
+        RasterMsTotal += std::chrono::duration<double, std::milli>(rasterized - start).count();
+        TestMsTotal += std::chrono::duration<double, std::milli>(end - rasterized).count();
+    }
+
+    void PrintSummary() const
+    {
+        if (Frames == 0)
+            return;
+        std::cout << "Software occlusion (" << Width << "x" << Height << ", " << SimdLanes << "-wide): avg "
+                  << OccludersTotal / Frames << " occluders, " << TrianglesTotal / Frames << " triangles, "
+                  << OccludedTotal / Frames << " of " << TestedTotal / Frames << " objects occluded, raster "
+                  << RasterMsTotal / Frames << " ms, test " << TestMsTotal / Frames << " ms per frame" << std::endl;
+    }
+
+private:
+#if defined(__AVX__)
+    static const int SimdLanes = 8;
+#elif defined(__SSE2__) || defined(_M_X64)
+    static const int SimdLanes = 4;
+#else
+    static const int SimdLanes = 1;
+#endif
+
+    // 物体在深度缓冲中的像素矩形 (含两端) 和最近深度；包围盒跨过摄像机平面时无法投影
+    struct ScreenBounds
+    {
+        int MinX = 0, MinY = 0, MaxX = -1, MaxY = -1;
+        float Nearest = 0.0f;
+        float Area = 0.0f;
+        bool CrossesNear = false;
+    };
+    // 屏幕空间三角形: 3 条边函数 E(x, y) = A x + B y + C (内部 >= 0) 和深度平面 z = ZA x + ZB y + ZC
+    struct Triangle
+    {
+        float A[3], B[3], C[3];
+        float ZA, ZB, ZC;
+        int MinX, MinY, MaxX, MaxY;
+    };
+
+    std::vector<glm::vec3> positions;
+    std::vector<int> indices;
+    std::vector<ScreenBounds> screenBounds;
+    std::vector<int> occluders; // screenBounds 的下标
+    std::vector<Triangle> triangles;
+    std::vector<char> occluded;
+    std::vector<glm::vec4> clipVertices;
+
+    ScreenBounds project(const Aabb& box, const glm::mat4& viewProjection) const
+    {
+        ScreenBounds bounds;
+        glm::vec2 rectMin(1.0f), rectMax(-1.0f);
+        float nearest = 1.0f;
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            glm::vec3 p((corner & 1) ? box.Max.x : box.Min.x, (corner & 2) ? box.Max.y : box.Min.y, (corner & 4) ? box.Max.z : box.Min.z);
+            glm::vec4 clip = viewProjection * glm::vec4(p, 1.0f);
+            if (clip.w <= 0.0f)
+            {
+                bounds.CrossesNear = true;
+                return bounds;
+            }
+            glm::vec3 ndc = glm::vec3(clip) / clip.w;
+            rectMin = glm::min(rectMin, glm::vec2(ndc.x, ndc.y));
+            rectMax = glm::max(rectMax, glm::vec2(ndc.x, ndc.y));
+            nearest = std::min(nearest, ndc.z * 0.5f + 0.5f);
+        }
+        glm::vec2 size(static_cast<float>(Width), static_cast<float>(Height));
+        glm::vec2 pixelMin = glm::clamp(rectMin * 0.5f + 0.5f, glm::vec2(0.0f), glm::vec2(1.0f)) * size;
+        glm::vec2 pixelMax = glm::clamp(rectMax * 0.5f + 0.5f, glm::vec2(0.0f), glm::vec2(1.0f)) * size;
+        bounds.Area = (pixelMax.x - pixelMin.x) * (pixelMax.y - pixelMin.y);
+        // 向外扩一个像素 (见类注释)
+        bounds.MinX = std::max(static_cast<int>(pixelMin.x) - 1, 0);
+        bounds.MinY = std::max(static_cast<int>(pixelMin.y) - 1, 0);
+        bounds.MaxX = std::min(static_cast<int>(pixelMax.x) + 1, Width - 1);
+        bounds.MaxY = std::min(static_cast<int>(pixelMax.y) + 1, Height - 1);
+        bounds.Nearest = nearest;
+        return bounds;
+    }
+
+    // 跨过摄像机平面的物体离得最近，总是优先；其余按屏幕面积取最大的 MaxOccluders 个
+    void selectOccluders(int count)
+    {
+        occluders.clear();
+        for (int i = 0; i < count; ++i)
+            if (screenBounds[i].CrossesNear || screenBounds[i].Area >= MinOccluderArea)
+                occluders.push_back(i);
+        auto larger = [&](int a, int b) {
+            const ScreenBounds& x = screenBounds[a];
+            const ScreenBounds& y = screenBounds[b];
+            if (x.CrossesNear != y.CrossesNear)
+                return x.CrossesNear;
+            return x.Area > y.Area;
+        };
+        if (static_cast<int>(occluders.size()) > MaxOccluders)
+        {
+            std::nth_element(occluders.begin(), occluders.begin() + MaxOccluders, occluders.end(), larger);
+            occluders.resize(MaxOccluders);
+        }
+    }
+
+    void buildTriangles(const glm::mat4& viewProjection, const std::vector<uint32_t>& visible,
+                        const std::function<glm::mat4(uint32_t)>& objectModel)
+    {
+        triangles.clear();
+        clipVertices.resize(positions.size());
+        for (int occluder : occluders)
+        {
+            glm::mat4 transform = viewProjection * objectModel(visible[occluder]);
+            for (size_t v = 0; v < positions.size(); ++v)
+                clipVertices[v] = transform * glm::vec4(positions[v], 1.0f);
+            for (size_t i = 0; i + 2 < indices.size(); i += 3)
+                clipAndAdd(clipVertices[indices[i]], clipVertices[indices[i + 1]], clipVertices[indices[i + 2]]);
+        }
+    }
+
+    // 对近平面 (z >= -w) 裁剪，结果 (至多 4 个顶点) 按扇形拆成三角形
+    void clipAndAdd(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c)
+    {
+        const glm::vec4 input[3] = { a, b, c };
+        glm::vec4 polygon[4];
+        int count = 0;
+        for (int i = 0; i < 3; ++i)
+        {
+            const glm::vec4& p = input[i];
+            const glm::vec4& q = input[(i + 1) % 3];
+            float dp = p.z + p.w, dq = q.z + q.w;
+            if (dp >= 0.0f)
+                polygon[count++] = p;
+            if ((dp >= 0.0f) != (dq >= 0.0f))
+                polygon[count++] = p + (q - p) * (dp / (dp - dq));
+        }
+        for (int i = 1; i + 1 < count; ++i)
+            addTriangle(polygon[0], polygon[i], polygon[i + 1]);
+    }
+
+    void addTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c)
+    {
+        // 到深度缓冲像素坐标 (像素中心在 +0.5 处)
+        glm::vec3 v[3];
+        const glm::vec4* clip[3] = { &a, &b, &c };
+        for (int i = 0; i < 3; ++i)
+        {
+            float invW = 1.0f / std::max(clip[i]->w, 1e-6f);
+            v[i] = glm::vec3((clip[i]->x * invW * 0.5f + 0.5f) * Width, (clip[i]->y * invW * 0.5f + 0.5f) * Height,
+                             clip[i]->z * invW * 0.5f + 0.5f);
+        }
+        float area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[2].x - v[0].x) * (v[1].y - v[0].y);
+        if (std::abs(area) < 1e-8f)
+            return;
+        if (area < 0.0f) // 统一为逆时针，边函数内部为正 (遮挡物两面都要画，不做背面剔除)
+        {
+            std::swap(v[1], v[2]);
+            area = -area;
+        }
+        Triangle tri;
+        float minX = std::min({ v[0].x, v[1].x, v[2].x }), maxX = std::max({ v[0].x, v[1].x, v[2].x });
+        float minY = std::min({ v[0].y, v[1].y, v[2].y }), maxY = std::max({ v[0].y, v[1].y, v[2].y });
+        tri.MinX = std::max(static_cast<int>(std::floor(minX)), 0);
+        tri.MinY = std::max(static_cast<int>(std::floor(minY)), 0);
+        tri.MaxX = std::min(static_cast<int>(std::ceil(maxX)), Width - 1);
+        tri.MaxY = std::min(static_cast<int>(std::ceil(maxY)), Height - 1);
+        if (tri.MinX > tri.MaxX || tri.MinY > tri.MaxY)
+            return;
+        for (int i = 0; i < 3; ++i)
+        {
+            const glm::vec3& p = v[i];
+            const glm::vec3& q = v[(i + 1) % 3];
+            tri.A[i] = p.y - q.y;
+            tri.B[i] = q.x - p.x;
+            tri.C[i] = p.x * q.y - p.y * q.x;
+        }
+        // 深度平面: 重心坐标插值 z
+        float invArea = 1.0f / area;
+        glm::vec3 e1 = v[1] - v[0], e2 = v[2] - v[0];
+        tri.ZA = (e1.z * e2.y - e2.z * e1.y) * invArea;
+        tri.ZB = (e2.z * e1.x - e1.z * e2.x) * invArea;
+        tri.ZC = v[0].z - tri.ZA * v[0].x - tri.ZB * v[0].y;
+        triangles.push_back(tri);
+    }
+
+    void rasterizeBand(int band)
+    {
+        int firstRow = band * BandRows, lastRow = firstRow + BandRows - 1;
+        std::fill(Depth.begin() + static_cast<size_t>(firstRow) * Width, Depth.begin() + static_cast<size_t>(lastRow + 1) * Width, 1.0f);
+        for (const Triangle& tri : triangles)
+        {
+            int y0 = std::max(tri.MinY, firstRow), y1 = std::min(tri.MaxY, lastRow);
+            for (int y = y0; y <= y1; ++y)
+                rasterizeRow(tri, y);
+        }
+        // 块最大深度
+        const int tilesX = Width / TileSize;
+        for (int ty = firstRow / TileSize; ty <= lastRow / TileSize; ++ty)
+            for (int tx = 0; tx < tilesX; ++tx)
+            {
+                float farthest = 0.0f;
+                for (int y = ty * TileSize; y < (ty + 1) * TileSize; ++y)
+                    for (int x = tx * TileSize; x < (tx + 1) * TileSize; ++x)
+                        farthest = std::max(farthest, Depth[static_cast<size_t>(y) * Width + x]);
+                TileMaxDepth[static_cast<size_t>(ty) * tilesX + tx] = farthest;
+            }
+    }
+
+    // 第 y 行上三角形包围盒内的像素，x 起点对齐到 SIMD 宽度 (Width 是 SimdLanes 的倍数，不会越界)
+    void rasterizeRow(const Triangle& tri, int y)
+    {
+        float* row = &Depth[static_cast<size_t>(y) * Width];
+        float py = y + 0.5f;
+        float rowC[3];
+        for (int i = 0; i < 3; ++i)
+            rowC[i] = tri.B[i] * py + tri.C[i];
+        float rowZ = tri.ZB * py + tri.ZC;
+        int x = tri.MinX - tri.MinX % SimdLanes;
+#if defined(__AVX__)
+        const __m256 laneOffsets = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+        const __m256 zero = _mm256_setzero_ps();
+        for (; x <= tri.MaxX; x += 8)
+        {
+            __m256 px = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x)), laneOffsets);
+            __m256 e0 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(tri.A[0]), px), _mm256_set1_ps(rowC[0]));
+            __m256 e1 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(tri.A[1]), px), _mm256_set1_ps(rowC[1]));
+            __m256 e2 = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(tri.A[2]), px), _mm256_set1_ps(rowC[2]));
+            __m256 inside = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(e0, zero, _CMP_GE_OQ), _mm256_cmp_ps(e1, zero, _CMP_GE_OQ)),
+                                          _mm256_cmp_ps(e2, zero, _CMP_GE_OQ));
+            if (_mm256_movemask_ps(inside) == 0)
+                continue;
+            __m256 z = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(tri.ZA), px), _mm256_set1_ps(rowZ));
+            __m256 old = _mm256_loadu_ps(row + x);
+            _mm256_storeu_ps(row + x, _mm256_blendv_ps(old, _mm256_min_ps(old, z), inside));
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+        const __m128 zero = _mm_setzero_ps();
+        for (; x <= tri.MaxX; x += 4)
+        {
+            __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+            __m128 e0 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.A[0]), px), _mm_set1_ps(rowC[0]));
+            __m128 e1 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.A[1]), px), _mm_set1_ps(rowC[1]));
+            __m128 e2 = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.A[2]), px), _mm_set1_ps(rowC[2]));
+            __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero));
+            if (_mm_movemask_ps(inside) == 0)
+                continue;
+            __m128 z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(tri.ZA), px), _mm_set1_ps(rowZ));
+            __m128 old = _mm_loadu_ps(row + x);
+            __m128 nearer = _mm_min_ps(old, z);
+            _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, old)));
+        }
+#else
+        for (; x <= tri.MaxX; ++x)
+        {
+            float px = x + 0.5f;
+            if (tri.A[0] * px + rowC[0] >= 0.0f && tri.A[1] * px + rowC[1] >= 0.0f && tri.A[2] * px + rowC[2] >= 0.0f)
+                row[x] = std::min(row[x], tri.ZA * px + rowZ);
+        }
+#endif
+    }
+
+    bool isOccluded(const ScreenBounds& bounds) const
+    {
+        if (bounds.CrossesNear)
+            return false;
+        const int tilesX = Width / TileSize;
+        for (int ty = bounds.MinY / TileSize; ty <= bounds.MaxY / TileSize; ++ty)
+            for (int tx = bounds.MinX / TileSize; tx <= bounds.MaxX / TileSize; ++tx)
+            {
+                // 整块都比物体近: 这一块内的部分一定被挡住
+                if (TileMaxDepth[static_cast<size_t>(ty) * tilesX + tx] < bounds.Nearest)
+                    continue;
+                int x0 = std::max(bounds.MinX, tx * TileSize), x1 = std::min(bounds.MaxX, (tx + 1) * TileSize - 1);
+                int y0 = std::max(bounds.MinY, ty * TileSize), y1 = std::min(bounds.MaxY, (ty + 1) * TileSize - 1);
+                for (int y = y0; y <= y1; ++y)
+                    for (int x = x0; x <= x1; ++x)
+                        if (Depth[static_cast<size_t>(y) * Width + x] >= bounds.Nearest)
+                            return false;
+            }
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// 常驻工作线程池
+// 每帧都要并行执行的小任务 (光源分簇等) 不适合每次新建线程，这里的线程在构造时创建，
+// 空闲时阻塞在条件变量上。ParallelFor 会把调用线程也算作一个工作者。
+class ThreadPool
+{
+public:
+    // threadCount: 包括调用线程在内的总线程数，0 表示使用 hardware_concurrency
+    explicit ThreadPool(unsigned int threadCount = 0)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned int i = 1; i < threadCount; ++i)
+            workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned int ThreadCount() const { return static_cast<unsigned int>(workers.size()) + 1; }
+
+    // 对 [0, count) 中的每个下标调用 fn(index)，各线程动态领取下标，返回时全部完成
+    void ParallelFor(int count, const std::function<void(int)>& fn)
+    {
+        if (workers.empty() || count <= 1)
+        {
+            for (int i = 0; i < count; ++i)
+                fn(i);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = &fn;
+            jobCount = count;
+            nextIndex.store(0, std::memory_order_relaxed);
+            pendingWorkers = workers.size();
+            ++generation;
+        }
+        wake.notify_all();
+        runJob(fn, count);
+        // 等所有工作线程都确认完成本轮任务，之后 fn 才能被销毁
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] { return pendingWorkers == 0; });
+        job = nullptr;
+    }
+
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(int)>* job = nullptr;
+    int jobCount = 0;
+    std::atomic<int> nextIndex{ 0 };
+    size_t pendingWorkers = 0;
+    unsigned long long generation = 0;
+    bool stopping = false;
+
+    void runJob(const std::function<void(int)>& fn, int count)
+    {
+        for (int i = nextIndex.fetch_add(1); i < count; i = nextIndex.fetch_add(1))
+            fn(i);
+    }
+
+    void workerLoop()
+    {
+        unsigned long long seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true)
+        {
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping)
+                return;
+            seen = generation;
+            const std::function<void(int)>* fn = job;
+            int count = jobCount;
+            lock.unlock();
+            runJob(*fn, count);
+            lock.lock();
+            if (--pendingWorkers == 0)
+                done.notify_one();
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,203 @@
+// 文件名: tiled_lighting.cs
+#version 430 core
+// 分块 (tiled) 延迟光照计算着色器
+// 每个工作组处理屏幕上的一个 16x16 像素块:
+//   1. 读取 G-buffer，求出块内几何体的最小/最大视图空间深度
+//   2. 用块的四个侧面和深度范围组成的视锥体剔除光源，可见光源的索引写入共享内存
+//   3. 每个像素只对块内可见的光源做光照计算
+// G-buffer 布局的预处理定义与 lighting_pass.fs 相同。
+// 块内可见光源超过 MAX_LIGHTS_PER_TILE 时，这个块退回遍历全部光源 (结果仍然正确，只是更慢)，
+// 并在 overflowTiles 中计数。
+#define TILE_SIZE 16
+#define MAX_LIGHTS_PER_TILE 256
+
+layout (local_size_x = TILE_SIZE, local_size_y = TILE_SIZE) in;
+
+// 与 lights.h 中的 PointLight 一致
+struct PointLight
+{
+    vec4 PositionRadius; // xyz: 世界空间位置, w: 影响半径
+    vec4 Color;          // rgb: 颜色
+};
+layout (std430, binding = 0) readonly buffer LightBuffer
+{
+    PointLight lights[];
+};
+
+// 溢出块计数，跨帧累加，由 CPU 在退出时读取
+layout (std430, binding = 1) buffer TileStats
+{
+    uint overflowTiles;
+};
+
+layout (rgba8, binding = 0) uniform writeonly image2D outputImage; // 光照结果
+
+// G-Buffer 纹理采样器 (用 texelFetch 按像素读取，G-buffer 大于窗口时直接读左下角子矩形)
+#ifdef GBUFFER_RECONSTRUCT_POSITION
+uniform sampler2D gDepth;
+uniform mat4 invViewProjection;
+#else
+uniform sampler2D gPosition;
+#endif
+uniform sampler2D gNormal;
+uniform sampler2D gAlbedoSpec;
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec3 viewPos;
+uniform int lightCount;
+uniform ivec2 screenSize;
+
+// 块内共享数据
+shared uint tileMinDepth; // 正浮点数的位模式与数值同序，可以直接做 atomicMin/atomicMax
+shared uint tileMaxDepth;
+shared uint tileLightCount;
+shared uint tileLightIndices[MAX_LIGHTS_PER_TILE];
+
+#ifdef GBUFFER_OCT_NORMALS
+// 八面体编码法线的解码 (编码见 g_buffer.fs)
+vec3 decodeOctahedral(vec2 e)
+{
+    e = e * 2.0 - 1.0;
+    vec3 n = vec3(e.x, e.y, 1.0 - abs(e.x) - abs(e.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+#endif
+
+void main()
+{
+    ivec2 pixel = ivec2(gl_GlobalInvocationID.xy);
+    bool inside = pixel.x < screenSize.x && pixel.y < screenSize.y;
+    uint localIndex = gl_LocalInvocationIndex;
+
+    if (localIndex == 0u)
+    {
+        tileMinDepth = 0xFFFFFFFFu;
+        tileMaxDepth = 0u;
+        tileLightCount = 0u;
+    }
+    barrier();
+
+    // 1. 从 G-Buffer 恢复几何/颜色信息
+    vec3 FragPos = vec3(0.0);
+    vec3 Normal = vec3(0.0);
+    vec4 AlbedoSpec = vec4(0.0);
+    bool hasGeometry = false;
+    if (inside)
+    {
+#ifdef GBUFFER_RECONSTRUCT_POSITION
+        float depth = texelFetch(gDepth, pixel, 0).r;
+        vec2 screenUV = (vec2(pixel) + 0.5) / vec2(screenSize);
+        vec4 world = invViewProjection * vec4(vec3(screenUV, depth) * 2.0 - 1.0, 1.0);
+        FragPos = world.xyz / world.w;
+#else
+        FragPos = texelFetch(gPosition, pixel, 0).rgb;
+#endif
+#ifdef GBUFFER_OCT_NORMALS
+        Normal = decodeOctahedral(texelFetch(gNormal, pixel, 0).rg);
+        hasGeometry = depth < 1.0;
+#else
+        Normal = texelFetch(gNormal, pixel, 0).rgb;
+        hasGeometry = length(Normal) > 0.1;
+#endif
+        AlbedoSpec = texelFetch(gAlbedoSpec, pixel, 0);
+    }
+
+    // 2. 块内深度范围 (视图空间，到相机的正距离)
+    if (hasGeometry)
+    {
+        float viewDepth = max(-(view * vec4(FragPos, 1.0)).z, 0.0);
+        atomicMin(tileMinDepth, floatBitsToUint(viewDepth));
+        atomicMax(tileMaxDepth, floatBitsToUint(viewDepth));
+    }
+    barrier();
+
+    // 3. 光源剔除: 整个工作组分摊遍历光源列表
+    if (tileMaxDepth >= tileMinDepth) // 块内没有几何体时跳过
+    {
+        float minDepth = uintBitsToFloat(tileMinDepth);
+        float maxDepth = uintBitsToFloat(tileMaxDepth);
+
+        // 块边界的 NDC 坐标换算成视图空间的斜率 (x / -z)，构造过原点的四个侧面
+        // 平面法线朝向块内，点到平面的距离 >= -radius 时球体与该侧相交
+        vec2 projectionScale = vec2(projection[0][0], projection[1][1]);
+        vec2 tileMin = (vec2(gl_WorkGroupID.xy * uint(TILE_SIZE)) / vec2(screenSize) * 2.0 - 1.0) / projectionScale;
+        vec2 tileMax = (vec2((gl_WorkGroupID.xy + 1u) * uint(TILE_SIZE)) / vec2(screenSize) * 2.0 - 1.0) / projectionScale;
+        vec3 planes[4] = vec3[4](
+            normalize(vec3( 1.0,  0.0,  tileMin.x)),  // 左
+            normalize(vec3(-1.0,  0.0, -tileMax.x)),  // 右
+            normalize(vec3( 0.0,  1.0,  tileMin.y)),  // 下
+            normalize(vec3( 0.0, -1.0, -tileMax.y))); // 上
+
+        for (uint i = localIndex; i < uint(lightCount); i += uint(TILE_SIZE * TILE_SIZE))
+        {
+            vec4 positionRadius = lights[i].PositionRadius;
+            vec3 center = (view * vec4(positionRadius.xyz, 1.0)).xyz;
+            float radius = positionRadius.w;
+            float depth = -center.z;
+            if (depth + radius < minDepth || depth - radius > maxDepth)
+                continue;
+            bool visible = true;
+            for (int p = 0; p < 4; ++p)
+            {
+                if (dot(planes[p], center) < -radius)
+                {
+                    visible = false;
+                    break;
+                }
+            }
+            if (visible)
+            {
+                uint slot = atomicAdd(tileLightCount, 1u);
+                if (slot < uint(MAX_LIGHTS_PER_TILE))
+                    tileLightIndices[slot] = i;
+            }
+        }
+    }
+    barrier();
+
+    bool overflow = tileLightCount > uint(MAX_LIGHTS_PER_TILE);
+    if (overflow && localIndex == 0u)
+        atomicAdd(overflowTiles, 1u);
+
+    if (!inside)
+        return;
+
+    // 4. 只对块内可见的光源执行光照计算 (与 lighting_pass.fs 相同的 Blinn-Phong 模型)
+    vec3 lighting;
+    if (hasGeometry)
+    {
+        vec3 Albedo = AlbedoSpec.rgb;
+        float SpecularStrength = AlbedoSpec.a;
+        vec3 viewDir = normalize(viewPos - FragPos);
+        vec3 accumulated = vec3(0.1); // 环境光只计算一次
+        uint count = overflow ? uint(lightCount) : tileLightCount;
+        for (uint i = 0u; i < count; ++i)
+        {
+            PointLight light = lights[overflow ? i : tileLightIndices[i]];
+            vec3 toLight = light.PositionRadius.xyz - FragPos;
+            float distance = length(toLight);
+            float radius = light.PositionRadius.w;
+            if (distance >= radius)
+                continue;
+            // 窗口衰减: 在半径处平滑降为 0
+            float falloff = 1.0 - pow(distance / radius, 4.0);
+            falloff *= falloff;
+
+            vec3 lightDir = toLight / distance;
+            float diff = max(dot(Normal, lightDir), 0.0);
+            vec3 halfwayDir = normalize(lightDir + viewDir);
+            float spec = pow(max(dot(Normal, halfwayDir), 0.0), 32.0);
+            accumulated += (diff + SpecularStrength * spec) * light.Color.rgb * falloff;
+        }
+        lighting = accumulated * Albedo;
+    }
+    else
+    {
+        lighting = AlbedoSpec.rgb; // 背景像素直接输出清除色
+    }
+    imageStore(outputImage, pixel, vec4(lighting, 1.0));
+}
@@ -0,0 +1,146 @@
+#ifndef TILED_LIGHTING_H
+#define TILED_LIGHTING_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "gbuffer.h"
+#include "lights.h"
+#include "shader_m.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+// 分块延迟光照 (计算着色器，需要 GL 4.3)
+// 光源列表放在 SSBO 中，tiled_lighting.cs 按 16x16 像素块剔除光源后着色，
+// 结果写入一张与 G-buffer 同尺寸的纹理，再 blit 到输出帧缓冲。
+// 每块最多在共享内存中记录 MaxLightsPerTile 个光源；超出的块 (光源密集处) 退回遍历全部光源，
+// 着色正确但失去分块的收益，溢出块数在 PrintSummary 中报告。
+class TiledLighting
+{
+public:
+    static const int TileSize = 16;          // 与 tiled_lighting.cs 中的 TILE_SIZE 一致
+    static const int MaxLightsPerTile = 256; // 与 tiled_lighting.cs 中的 MAX_LIGHTS_PER_TILE 一致
+
+    Shader Program;
+    unsigned int LightSSBO = 0;
+    unsigned int OutputTexture = 0;
+    unsigned int OutputFBO = 0;
+    unsigned int StatsSSBO = 0; // 溢出块计数 (GPU 上跨帧累加)
+
+    // 累计统计
+    int Frames = 0;
+    long long Tiles = 0;
+
+    // 不支持计算着色器或编译失败时返回 false，调用方回退到全屏四边形光照
+    bool Create(const std::string& defines, const GBuffer& gBuffer)
+    {
+        if (!GLAD_GL_VERSION_4_3)
+        {
+            std::cout << "ERROR::TILED_LIGHTING::REQUIRES_GL_4_3" << std::endl;
+            return false;
+        }
+        Program = Shader::Compute("../tiled_lighting.cs", defines);
+        if (Program.ID == 0)
+            return false;
+        gBuffer.SetSamplerUniforms(Program);
+
+        glGenBuffers(1, &LightSSBO);
+        glGenFramebuffers(1, &OutputFBO);
+        unsigned int zero = 0;
+        glGenBuffers(1, &StatsSSBO);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, StatsSSBO);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(zero), &zero, GL_DYNAMIC_READ);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        return true;
+    }
+
+    void Destroy()
+    {
+        if (Program.ID != 0)
+            glDeleteProgram(Program.ID);
+        glDeleteBuffers(1, &LightSSBO);
+        glDeleteBuffers(1, &StatsSSBO);
+        glDeleteTextures(1, &OutputTexture);
+        glDeleteFramebuffers(1, &OutputFBO);
+        Program.ID = 0;
+        LightSSBO = StatsSSBO = OutputTexture = OutputFBO = 0;
+    }
+
+    // 每帧上传一次全部光源
+    void UploadLights(const std::vector<PointLight>& lights)
+    {
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, LightSSBO);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, lights.size() * sizeof(PointLight), lights.data(), GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        lightCount = static_cast<int>(lights.size());
+    }
+
+    // 执行光照计算并把结果 blit 到 targetFBO (范围为 G-buffer 当前使用的子矩形)
+    void Dispatch(const GBuffer& gBuffer, const glm::mat4& view, const glm::mat4& projection, const glm::vec3& viewPos, unsigned int targetFBO)
+    {
+        ensureOutput(gBuffer.Capacity);
+
+        Program.use();
+        gBuffer.BindTextures();
+        Program.setMat4("view", view);
+        Program.setMat4("projection", projection);
+        Program.setMat4("invViewProjection", glm::inverse(projection * view));
+        Program.setVec3("viewPos", viewPos);
+        Program.setInt("lightCount", lightCount);
+        glUniform2i(glGetUniformLocation(Program.ID, "screenSize"), gBuffer.Size.x, gBuffer.Size.y);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, LightSSBO);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, StatsSSBO);
+        glBindImageTexture(0, OutputTexture, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+
+        int tilesX = (gBuffer.Size.x + TileSize - 1) / TileSize;
+        int tilesY = (gBuffer.Size.y + TileSize - 1) / TileSize;
+        glDispatchCompute(tilesX, tilesY, 1);
+        ++Frames;
+        Tiles += static_cast<long long>(tilesX) * tilesY;
+        // 保证 imageStore 的结果对随后的 blit 可见
+        glMemoryBarrier(GL_FRAMEBUFFER_BARRIER_BIT);
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, OutputFBO);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, targetFBO);
+        glBlitFramebuffer(0, 0, gBuffer.Size.x, gBuffer.Size.y, 0, 0, gBuffer.Size.x, gBuffer.Size.y, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, targetFBO);
+    }
+
+    // 退出时读取一次溢出计数 (只在这里同步)
+    void PrintSummary() const
+    {
+        if (Frames == 0 || StatsSSBO == 0)
+            return;
+        unsigned int overflowTiles = 0;
+        // atomicAdd 的写入要经过这个屏障才对 glGetBufferSubData 可见
+        glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, StatsSSBO);
+        glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(overflowTiles), &overflowTiles);
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+        std::cout << "Tiled lighting: " << lightCount << " lights, avg " << Tiles / Frames << " tiles, "
+                  << overflowTiles << " tile dispatches over " << MaxLightsPerTile << " lights (shaded with all lights)" << std::endl;
+    }
+
+private:
+    int lightCount = 0;
+    glm::ivec2 outputSize = glm::ivec2(0);
+
+    // 输出纹理跟随 G-buffer 的分配尺寸，只在 G-buffer 重建时重建
+    void ensureOutput(glm::ivec2 size)
+    {
+        if (size == outputSize)
+            return;
+        outputSize = size;
+        glDeleteTextures(1, &OutputTexture);
+        glGenTextures(1, &OutputTexture);
+        glBindTexture(GL_TEXTURE_2D, OutputTexture);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, size.x, size.y);
+        glBindFramebuffer(GL_FRAMEBUFFER, OutputFBO);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, OutputTexture, 0);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+};
+
+#endif
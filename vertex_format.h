@@ -0,0 +1,215 @@
+#ifndef VERTEX_FORMAT_H
+#define VERTEX_FORMAT_H
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include "render_options.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// 顶点属性的存储编码
+enum VertexEncoding
+{
+    VERTEX_FLOAT32,            // 原样存储 float
+    VERTEX_HALF_FLOAT,         // 16 位半精度浮点
+    VERTEX_SNORM16_SCALE_BIAS, // 减去 bias、除以 scale 后量化为 16 位 snorm，顶点着色器中乘回 (每个网格一组 scale/bias)
+    VERTEX_SNORM_10_10_10_2    // GL_INT_2_10_10_10_REV 打包的 3 分量单位向量 (w 固定为 0)
+};
+
+// 顶点属性描述
+// 网格上传 (编码、步长、偏移) 和 VAO 的 glVertexAttribPointer 都只读这张表，
+// 顶点着色器需要的反量化代码也由表生成 (见 GetVertexFormatDefines)。
+struct VertexAttribute
+{
+    const char* Name;      // 着色器中的输入名 (同时用于调试输出)
+    GLuint Location;       // layout (location = N)
+    int SourceOffset;      // 在交错 float 源数据中的偏移 (float 个数)
+    int Components;        // 源数据的分量数
+    VertexEncoding Encoding;
+};
+
+// 位置 / 法线 / 纹理坐标交错的标准顶点 (每个顶点 8 个 float) 在各格式下的描述表
+inline std::vector<VertexAttribute> GetVertexAttributes(VertexFormat format)
+{
+    switch (format)
+    {
+    case VERTEX_FORMAT_COMPRESSED: // 16 字节/顶点
+        return {
+            { "aPos",       0, 0, 3, VERTEX_SNORM16_SCALE_BIAS }, // 4 x GL_SHORT (第 4 个分量用于对齐)
+            { "aNormal",    1, 3, 3, VERTEX_SNORM_10_10_10_2 },   // GL_INT_2_10_10_10_REV
+            { "aTexCoords", 2, 6, 2, VERTEX_HALF_FLOAT },         // 2 x GL_HALF_FLOAT
+        };
+    case VERTEX_FORMAT_FLOAT:
+    default: // 32 字节/顶点
+        return {
+            { "aPos",       0, 0, 3, VERTEX_FLOAT32 },
+            { "aNormal",    1, 3, 3, VERTEX_FLOAT32 },
+            { "aTexCoords", 2, 6, 2, VERTEX_FLOAT32 },
+        };
+    }
+}
+
+// 顶点着色器的预处理定义: 位置使用 scale/bias 量化时声明反量化 uniform，并定义 VERTEX_POSITION 宏
+// (着色器中未定义 VERTEX_POSITION 时回退为原样使用 aPos)
+inline std::string GetVertexFormatDefines(const std::vector<VertexAttribute>& attributes)
+{
+    for (const VertexAttribute& attribute : attributes)
+        if (attribute.Location == 0 && attribute.Encoding == VERTEX_SNORM16_SCALE_BIAS)
+            return "uniform vec3 positionScale;\n"
+                   "uniform vec3 positionBias;\n"
+                   "#define VERTEX_POSITION(p) ((p) * positionScale + positionBias)\n";
+    return "";
+}
+
+// 编码后每个属性占用的字节数 (都是 4 的倍数，属性保持 4 字节对齐)
+inline int VertexAttributeSize(const VertexAttribute& attribute)
+{
+    switch (attribute.Encoding)
+    {
+    case VERTEX_HALF_FLOAT:
+        return ((attribute.Components * 2 + 3) / 4) * 4;
+    case VERTEX_SNORM16_SCALE_BIAS:
+        return ((attribute.Components * 2 + 3) / 4) * 4;
+    case VERTEX_SNORM_10_10_10_2:
+        return 4;
+    case VERTEX_FLOAT32:
+    default:
+        return attribute.Components * 4;
+    }
+}
+
+inline int VertexStride(const std::vector<VertexAttribute>& attributes)
+{
+    int stride = 0;
+    for (const VertexAttribute& attribute : attributes)
+        stride += VertexAttributeSize(attribute);
+    return stride;
+}
+
+// float -> IEEE 754 半精度 (就近舍入，超出范围时饱和为无穷大，非规格化数直接处理)
+inline uint16_t FloatToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    int exponent = static_cast<int>((bits >> 23) & 0xFF) - 127 + 15;
+    uint32_t mantissa = bits & 0x7FFFFFu;
+    if (((bits >> 23) & 0xFF) == 0xFF) // NaN / 无穷大
+        return static_cast<uint16_t>(sign | 0x7C00u | (mantissa ? 0x200u : 0u));
+    if (exponent >= 31)
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    if (exponent <= 0)
+    {
+        if (exponent < -10)
+            return static_cast<uint16_t>(sign);
+        mantissa |= 0x800000u;
+        int shift = 14 - exponent;
+        uint32_t half = mantissa >> shift;
+        if ((mantissa >> (shift - 1)) & 1u)
+            ++half;
+        return static_cast<uint16_t>(sign | half);
+    }
+    uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    if (mantissa & 0x1000u) // 舍入进位可能进到指数，结果仍然正确
+        ++half;
+    return static_cast<uint16_t>(half);
+}
+
+inline int16_t QuantizeSnorm16(float value)
+{
+    return static_cast<int16_t>(std::lround(std::max(-1.0f, std::min(1.0f, value)) * 32767.0f));
+}
+
+// 按 GL_INT_2_10_10_10_REV 打包: x 在低 10 位，依次是 y、z，最高 2 位是 w
+inline uint32_t PackSnorm1010102(const glm::vec3& v)
+{
+    auto component = [](float c) {
+        int q = static_cast<int>(std::lround(std::max(-1.0f, std::min(1.0f, c)) * 511.0f));
+        return static_cast<uint32_t>(q) & 0x3FFu;
+    };
+    return component(v.x) | (component(v.y) << 10) | (component(v.z) << 20);
+}
+
+// 把交错的 float 顶点按描述表编码。positionScale/positionBias 由调用方根据包围盒给出
+inline std::vector<unsigned char> EncodeVertices(const std::vector<VertexAttribute>& attributes, const float* vertices,
+                                                 int vertexCount, int floatsPerVertex,
+                                                 const glm::vec3& positionScale, const glm::vec3& positionBias)
+{
+    int stride = VertexStride(attributes);
+    std::vector<unsigned char> encoded(static_cast<size_t>(vertexCount) * stride, 0);
+    for (int i = 0; i < vertexCount; ++i)
+    {
+        const float* source = vertices + static_cast<size_t>(i) * floatsPerVertex;
+        unsigned char* out = encoded.data() + static_cast<size_t>(i) * stride;
+        for (const VertexAttribute& attribute : attributes)
+        {
+            const float* value = source + attribute.SourceOffset;
+            switch (attribute.Encoding)
+            {
+            case VERTEX_HALF_FLOAT:
+                for (int c = 0; c < attribute.Components; ++c)
+                {
+                    uint16_t half = FloatToHalf(value[c]);
+                    std::memcpy(out + c * 2, &half, 2);
+                }
+                break;
+            case VERTEX_SNORM16_SCALE_BIAS:
+                for (int c = 0; c < attribute.Components; ++c)
+                {
+                    float scale = positionScale[c] > 0.0f ? positionScale[c] : 1.0f;
+                    int16_t q = QuantizeSnorm16((value[c] - positionBias[c]) / scale);
+                    std::memcpy(out + c * 2, &q, 2);
+                }
+                break;
+            case VERTEX_SNORM_10_10_10_2:
+            {
+                uint32_t packed = PackSnorm1010102(glm::vec3(value[0], value[1], value[2]));
+                std::memcpy(out, &packed, 4);
+                break;
+            }
+            case VERTEX_FLOAT32:
+            default:
+                std::memcpy(out, value, attribute.Components * sizeof(float));
+                break;
+            }
+            out += VertexAttributeSize(attribute);
+        }
+    }
+    return encoded;
+}
+
+// 在当前绑定的 VAO 中按描述表设置属性指针 (顶点缓冲需已绑定到 GL_ARRAY_BUFFER)
+inline void SetupVertexAttributes(const std::vector<VertexAttribute>& attributes)
+{
+    GLsizei stride = VertexStride(attributes);
+    size_t offset = 0;
+    for (const VertexAttribute& attribute : attributes)
+    {
+        glEnableVertexAttribArray(attribute.Location);
+        switch (attribute.Encoding)
+        {
+        case VERTEX_HALF_FLOAT:
+            glVertexAttribPointer(attribute.Location, attribute.Components, GL_HALF_FLOAT, GL_FALSE, stride, (void*)offset);
+            break;
+        case VERTEX_SNORM16_SCALE_BIAS:
+            glVertexAttribPointer(attribute.Location, attribute.Components, GL_SHORT, GL_TRUE, stride, (void*)offset);
+            break;
+        case VERTEX_SNORM_10_10_10_2:
+            glVertexAttribPointer(attribute.Location, 4, GL_INT_2_10_10_10_REV, GL_TRUE, stride, (void*)offset);
+            break;
+        case VERTEX_FLOAT32:
+        default:
+            glVertexAttribPointer(attribute.Location, attribute.Components, GL_FLOAT, GL_FALSE, stride, (void*)offset);
+            break;
+        }
+        offset += VertexAttributeSize(attribute);
+    }
+}
+
+#endif